@@ -44,8 +44,10 @@ namespace jni
 		private:
 			static std::unordered_map<std::type_index, std::shared_ptr<JavaClass>> & getClassMap()
 			{
-				static std::unordered_map<std::type_index, std::shared_ptr<JavaClass>> map;
-				return map;
+				// Never destroyed, the cached global references must not be deleted
+				// by static destructors at exit, when the VM may already be gone.
+				static auto * map = new std::unordered_map<std::type_index, std::shared_ptr<JavaClass>>();
+				return *map;
 			}
 
 			static std::mutex & getMutex()
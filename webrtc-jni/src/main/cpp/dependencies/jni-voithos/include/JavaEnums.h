@@ -73,8 +73,10 @@ namespace jni
 		private:
 			static std::unordered_map<std::type_index, std::any> & getEnumMap()
 			{
-				static std::unordered_map<std::type_index, std::any> map;
-				return map;
+				// Never destroyed, the cached global references must not be deleted
+				// by static destructors at exit, when the VM may already be gone.
+				static auto * map = new std::unordered_map<std::type_index, std::any>();
+				return *map;
 			}
 #else
 			template <class T>
@@ -122,8 +124,10 @@ namespace jni
 		private:
 			static std::unordered_map<std::type_index, unique_void_ptr> & getEnumMap()
 			{
-				static std::unordered_map<std::type_index, unique_void_ptr> map;
-				return map;
+				// Never destroyed, the cached global references must not be deleted
+				// by static destructors at exit, when the VM may already be gone.
+				static auto * map = new std::unordered_map<std::type_index, unique_void_ptr>();
+				return *map;
 			}
 #endif
 	};
@@ -82,8 +82,10 @@ namespace jni
 		private:
 			static std::unordered_map<std::type_index, std::any> & getFactoryMap()
 			{
-				static std::unordered_map<std::type_index, std::any> map;
-				return map;
+				// Never destroyed, the cached global references must not be deleted
+				// by static destructors at exit, when the VM may already be gone.
+				static auto * map = new std::unordered_map<std::type_index, std::any>();
+				return *map;
 			}
 #else
 			template <class T>
@@ -139,8 +141,10 @@ namespace jni
 		private:
 			static std::unordered_map<std::type_index, unique_void_ptr> & getFactoryMap()
 			{
-				static std::unordered_map<std::type_index, unique_void_ptr> map;
-				return map;
+				// Never destroyed, the cached global references must not be deleted
+				// by static destructors at exit, when the VM may already be gone.
+				static auto * map = new std::unordered_map<std::type_index, unique_void_ptr>();
+				return *map;
 			}
 #endif
 	};
@@ -11,9 +11,20 @@
 #include "JavaUtils.h"
 
 #include <jni.h>
+#include <atomic>
+#include <cstdint>
 
 namespace jni
 {
+	// The number of global references currently held by JavaGlobalRef instances.
+	inline std::atomic<int64_t> & JavaGlobalRefCount()
+	{
+		static std::atomic<int64_t> count(0);
+
+		return count;
+	}
+
+
 	template <class T>
 	class JavaRef;
 
@@ -212,11 +223,13 @@ namespace jni
 			JavaGlobalRef(JNIEnv * env, T obj) :
 				JavaRef<T>(static_cast<T>(env->NewGlobalRef(obj)))
 			{
+				countGlobalRef();
 			}
 
 			JavaGlobalRef(JNIEnv * env, const JavaRef<T> & other)
 				: JavaRef<T>(static_cast<T>(env->NewGlobalRef(other.obj)))
 			{
+				countGlobalRef();
 			}
 
 			JavaGlobalRef(const JavaGlobalRef & other)
@@ -263,18 +276,29 @@ namespace jni
 				if (other.get()) {
 					JNIEnv * env = AttachCurrentThread();
 					this->obj = env->NewGlobalRef(other.get());
+
+					countGlobalRef();
+				}
+			}
+
+			void countGlobalRef()
+			{
+				if (this->obj != nullptr) {
+					JavaGlobalRefCount().fetch_add(1, std::memory_order_relaxed);
 				}
 			}
 
 			void deleteGlobalRef()
 			{
 				if (this->obj != nullptr) {
-					JNIEnv * env = nullptr;
+					JNIEnv * env = AttachCurrentThread();
 
 					if (env) {
 						env->DeleteGlobalRef(this->obj);
 					}
 
+					JavaGlobalRefCount().fetch_sub(1, std::memory_order_relaxed);
+
 					this->obj = nullptr;
 				}
 			}
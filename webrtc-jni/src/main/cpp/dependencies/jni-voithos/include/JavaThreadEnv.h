@@ -23,6 +23,8 @@ namespace jni
 		private:
 			JavaVM * vm;
 			JNIEnv * env;
+			// Whether the thread was attached by this instance and must be detached.
+			bool attached;
 	};
 }
 
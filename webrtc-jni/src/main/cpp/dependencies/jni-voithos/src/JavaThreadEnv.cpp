@@ -14,7 +14,8 @@ namespace jni
 {
 	JavaThreadEnv::JavaThreadEnv(JavaVM * vm) :
 		vm(vm),
-		env(nullptr)
+		env(nullptr),
+		attached(false)
 	{
 		int status = vm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6);
 
@@ -22,6 +23,9 @@ namespace jni
 			if (vm->AttachCurrentThread(reinterpret_cast<void**>(&env), NULL) != 0) {
 				std::cout << "VM attach current thread failed" << std::endl;
 			}
+			else {
+				attached = true;
+			}
 		}
 
 		if (env == nullptr) {
@@ -31,7 +35,10 @@ namespace jni
 
 	JavaThreadEnv::~JavaThreadEnv()
 	{
-		vm->DetachCurrentThread();
+		// Threads attached by the VM itself, e.g. Java threads, stay attached.
+		if (attached) {
+			vm->DetachCurrentThread();
+		}
 
 		//std::cout << "Dettached thread " << std::this_thread::get_id() << std::endl;
 	}
@@ -134,6 +134,11 @@ jfieldID GetFieldID(JNIEnv * env, jclass cls, const std::string & fieldName, con
 
 JNIEnv * AttachCurrentThread()
 {
+	if (javaContext == nullptr) {
+		// Not loaded yet or already unloaded, e.g. while static objects are destroyed.
+		return nullptr;
+	}
+
 	thread_local std::unique_ptr<jni::JavaThreadEnv> threadEnv(new jni::JavaThreadEnv(javaContext->getVM()));
 
 	return threadEnv->getEnv();
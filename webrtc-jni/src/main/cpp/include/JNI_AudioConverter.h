@@ -31,6 +31,14 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convertInternal
 	(JNIEnv*, jobject, jbyteArray, jint, jbyteArray, jint);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioConverter
+	 * Method:    convertDirect
+	 * Signature: (Ljava/nio/ByteBuffer;ILjava/nio/ByteBuffer;I)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convertDirect
+	(JNIEnv*, jobject, jobject, jint, jobject, jint);
+
 #ifdef __cplusplus
 }
 #endif
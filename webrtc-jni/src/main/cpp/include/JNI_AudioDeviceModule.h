@@ -77,7 +77,7 @@ extern "C" {
 	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioDevice;)V
 	 */
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_setPlayoutDevice
-	(JNIEnv *, jobject, jobject);
+	(JNIEnv*, jobject, jobject);
 
 	/*
 	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModule
@@ -85,7 +85,7 @@ extern "C" {
 	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioDevice;)V
 	 */
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_setRecordingDevice
-	(JNIEnv *, jobject, jobject);
+	(JNIEnv*, jobject, jobject);
 
 	/*
 	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModule
@@ -199,6 +199,22 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_removeSinkInternal
 	(JNIEnv*, jobject, jlong);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModule
+	 * Method:    addFileSinkInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/WavAudioFileSink;)J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_addFileSinkInternal
+	(JNIEnv*, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModule
+	 * Method:    removeFileSinkInternal
+	 * Signature: (J)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_removeFileSinkInternal
+	(JNIEnv*, jobject, jlong);
+
 	/*
 	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModule
 	 * Method:    addSourceInternal
@@ -215,6 +231,22 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_removeSourceInternal
 	(JNIEnv*, jobject, jlong);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModule
+	 * Method:    addFileSourceInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioSource;)J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_addFileSourceInternal
+	(JNIEnv*, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModule
+	 * Method:    removeFileSourceInternal
+	 * Signature: (J)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_removeFileSourceInternal
+	(JNIEnv*, jobject, jlong);
+
 	/*
 	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModule
 	 * Method:    disposeInternal
@@ -229,7 +261,7 @@ extern "C" {
 	 * Signature: ()V
 	 */
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_initialize
-	(JNIEnv *, jobject, jobject);
+	(JNIEnv*, jobject, jobject);
 
 #ifdef __cplusplus
 }
@@ -47,6 +47,14 @@ extern "C" {
 	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processReverseStream
 	(JNIEnv*, jobject, jbyteArray, jobject, jobject, jbyteArray);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
+	 * Method:    processDirect
+	 * Signature: (Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;IIIIIZ)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processDirect
+	(JNIEnv*, jobject, jobject, jobject, jint, jint, jint, jint, jint, jboolean);
+
 	/*
 	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
 	 * Method:    dispose
@@ -71,6 +79,14 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_updateStats
 	(JNIEnv*, jobject);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
+	 * Method:    updateFrameStats
+	 * Signature: (Ljava/nio/ByteBuffer;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_updateFrameStats
+	(JNIEnv*, jobject, jobject);
+
 #ifdef __cplusplus
 }
 #endif
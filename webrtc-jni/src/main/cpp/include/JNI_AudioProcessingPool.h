@@ -0,0 +1,61 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_audio_AudioProcessingPool */
+
+#ifndef _Included_dev_onvoid_webrtc_media_audio_AudioProcessingPool
+#define _Included_dev_onvoid_webrtc_media_audio_AudioProcessingPool
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessingPool
+	 * Method:    removeStream
+	 * Signature: (I)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_removeStream
+	(JNIEnv*, jobject, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessingPool
+	 * Method:    pollInternal
+	 * Signature: ([J[I[I)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_pollInternal
+	(JNIEnv*, jobject, jlongArray, jintArray, jintArray);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessingPool
+	 * Method:    disposeInternal
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_disposeInternal
+	(JNIEnv*, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessingPool
+	 * Method:    initialize
+	 * Signature: (II)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_initialize
+	(JNIEnv*, jobject, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessingPool
+	 * Method:    addStreamInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioProcessing;Ldev/onvoid/webrtc/media/audio/AudioProcessingStreamConfig;Ldev/onvoid/webrtc/media/audio/AudioProcessingStreamConfig;)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_addStreamInternal
+	(JNIEnv*, jobject, jobject, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessingPool
+	 * Method:    submitInternal
+	 * Signature: (ILjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;IJ)Z
+	 */
+	JNIEXPORT jboolean JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_submitInternal
+	(JNIEnv*, jobject, jint, jobject, jobject, jint, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -39,6 +39,14 @@ extern "C" {
 	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioResampler_resampleInternal
 	(JNIEnv*, jobject, jbyteArray, jint, jbyteArray, jint);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioResampler
+	 * Method:    resampleDirect
+	 * Signature: (Ljava/nio/Buffer;ILjava/nio/Buffer;IZ)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioResampler_resampleDirect
+	(JNIEnv*, jobject, jobject, jint, jobject, jint, jboolean);
+
 #ifdef __cplusplus
 }
 #endif
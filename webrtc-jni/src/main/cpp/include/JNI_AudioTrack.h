@@ -31,6 +31,22 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeSinkInternal
 	(JNIEnv *, jobject, jlong);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrack
+	 * Method:    addFileSinkInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/WavAudioFileSink;)J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_addFileSinkInternal
+	(JNIEnv *, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrack
+	 * Method:    removeFileSinkInternal
+	 * Signature: (J)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeFileSinkInternal
+	(JNIEnv *, jobject, jlong);
+
 #ifdef __cplusplus
 }
 #endif
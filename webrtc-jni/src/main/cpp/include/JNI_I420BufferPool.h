@@ -0,0 +1,37 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_video_I420BufferPool */
+
+#ifndef _Included_dev_onvoid_webrtc_media_video_I420BufferPool
+#define _Included_dev_onvoid_webrtc_media_video_I420BufferPool
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_I420BufferPool
+	 * Method:    setMaxBuffersInternal
+	 * Signature: (I)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_I420BufferPool_setMaxBuffersInternal
+	(JNIEnv *, jclass, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_I420BufferPool
+	 * Method:    getMaxBuffers
+	 * Signature: ()I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_video_I420BufferPool_getMaxBuffers
+	(JNIEnv *, jclass);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_I420BufferPool
+	 * Method:    release
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_I420BufferPool_release
+	(JNIEnv *, jclass);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,61 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_MediaRecorder */
+
+#ifndef _Included_dev_onvoid_webrtc_media_MediaRecorder
+#define _Included_dev_onvoid_webrtc_media_MediaRecorder
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_MediaRecorder
+	 * Method:    stop
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_stop
+	(JNIEnv*, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_MediaRecorder
+	 * Method:    isRecording
+	 * Signature: ()Z
+	 */
+	JNIEXPORT jboolean JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_isRecording
+	(JNIEnv*, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_MediaRecorder
+	 * Method:    getPayloadType
+	 * Signature: ()I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_getPayloadType
+	(JNIEnv*, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_MediaRecorder
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_dispose
+	(JNIEnv*, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_MediaRecorder
+	 * Method:    initialize
+	 * Signature: (Ldev/onvoid/webrtc/RTCRtpReceiver;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_initialize
+	(JNIEnv*, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_MediaRecorder
+	 * Method:    startInternal
+	 * Signature: (Ljava/lang/String;Ljava/lang/String;II)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_startInternal
+	(JNIEnv*, jobject, jstring, jstring, jint, jint);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
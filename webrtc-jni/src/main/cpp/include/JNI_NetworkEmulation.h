@@ -0,0 +1,61 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_NetworkEmulation */
+
+#ifndef _Included_dev_onvoid_webrtc_NetworkEmulation
+#define _Included_dev_onvoid_webrtc_NetworkEmulation
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_NetworkEmulation
+	 * Method:    isSupported
+	 * Signature: ()Z
+	 */
+	JNIEXPORT jboolean JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_isSupported
+	(JNIEnv *, jclass);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_NetworkEmulation
+	 * Method:    createNetwork
+	 * Signature: ()Ldev/onvoid/webrtc/EmulatedNetwork;
+	 */
+	JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_createNetwork
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_NetworkEmulation
+	 * Method:    createLink
+	 * Signature: (Ldev/onvoid/webrtc/EmulatedNetwork;Ldev/onvoid/webrtc/EmulatedNetwork;Ldev/onvoid/webrtc/NetworkEmulationConfig;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_createLink
+	(JNIEnv *, jobject, jobject, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_NetworkEmulation
+	 * Method:    updateLink
+	 * Signature: (Ldev/onvoid/webrtc/EmulatedNetwork;Ldev/onvoid/webrtc/EmulatedNetwork;Ldev/onvoid/webrtc/NetworkEmulationConfig;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_updateLink
+	(JNIEnv *, jobject, jobject, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_NetworkEmulation
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_dispose
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_NetworkEmulation
+	 * Method:    initialize
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_initialize
+	(JNIEnv *, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
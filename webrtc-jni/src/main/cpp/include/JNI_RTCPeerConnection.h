@@ -231,6 +231,22 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getStats__Ldev_onvoid_webrtc_RTCRtpSender_2Ldev_onvoid_webrtc_RTCStatsCollectorCallback_2
 	(JNIEnv *, jobject, jobject, jobject);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCPeerConnection
+	 * Method:    setBitrate
+	 * Signature: (Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_setBitrate
+	(JNIEnv *, jobject, jobject, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCPeerConnection
+	 * Method:    setBandwidthEstimationObserver
+	 * Signature: (Ldev/onvoid/webrtc/RTCBandwidthEstimationObserver;I)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_setBandwidthEstimationObserver
+	(JNIEnv *, jobject, jobject, jint);
+
 	/*
 	 * Class:     dev_onvoid_webrtc_RTCPeerConnection
 	 * Method:    restartIce
@@ -0,0 +1,37 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_audio_RawAudioFileSource */
+
+#ifndef _Included_dev_onvoid_webrtc_media_audio_RawAudioFileSource
+#define _Included_dev_onvoid_webrtc_media_audio_RawAudioFileSource
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_RawAudioFileSource
+	 * Method:    onPlaybackData
+	 * Signature: ([BIIII)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_RawAudioFileSource_onPlaybackData
+	(JNIEnv*, jobject, jbyteArray, jint, jint, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_RawAudioFileSource
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_RawAudioFileSource_dispose
+	(JNIEnv*, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_RawAudioFileSource
+	 * Method:    initialize
+	 * Signature: (Ljava/lang/String;Z)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_RawAudioFileSource_initialize
+	(JNIEnv*, jobject, jstring, jboolean);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -23,6 +23,22 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoBufferConverter_I420toDirectBuffer
 	(JNIEnv *, jclass, jobject, jint, jobject, jint, jobject, jint, jobject, jint, jint, jint);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_VideoBufferConverter
+	 * Method:    I420toByteArrayScaled
+	 * Signature: (Ljava/nio/ByteBuffer;ILjava/nio/ByteBuffer;ILjava/nio/ByteBuffer;IIIII[BIII)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoBufferConverter_I420toByteArrayScaled
+	(JNIEnv *, jclass, jobject, jint, jobject, jint, jobject, jint, jint, jint, jint, jint, jbyteArray, jint, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_VideoBufferConverter
+	 * Method:    I420toDirectBufferScaled
+	 * Signature: (Ljava/nio/ByteBuffer;ILjava/nio/ByteBuffer;ILjava/nio/ByteBuffer;IIIIILjava/nio/ByteBuffer;III)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoBufferConverter_I420toDirectBufferScaled
+	(JNIEnv *, jclass, jobject, jint, jobject, jint, jobject, jint, jint, jint, jint, jint, jobject, jint, jint, jint);
+
 #ifdef __cplusplus
 }
 #endif
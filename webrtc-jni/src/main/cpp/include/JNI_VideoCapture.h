@@ -31,6 +31,14 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoCapture_setVideoSink
 	(JNIEnv *, jobject, jobject);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_VideoCapture
+	 * Method:    setVideoFrameRing
+	 * Signature: (Ldev/onvoid/webrtc/media/video/VideoFrameRing;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoCapture_setVideoFrameRing
+	(JNIEnv *, jobject, jobject);
+
 	/*
 	 * Class:     dev_onvoid_webrtc_media_video_VideoCapture
 	 * Method:    start
@@ -39,6 +39,14 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_setFocusSelectedSource
 	(JNIEnv*, jobject, jboolean);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_VideoDesktopSource
+	 * Method:    setConversionStripes
+	 * Signature: (I)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_setConversionStripes
+	(JNIEnv*, jobject, jint);
+
 	/*
 	 * Class:     dev_onvoid_webrtc_media_video_VideoDesktopSource
 	 * Method:    start
@@ -55,6 +63,22 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_stop
 	(JNIEnv*, jobject);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_VideoDesktopSource
+	 * Method:    getStats
+	 * Signature: ()Ldev/onvoid/webrtc/media/video/VideoDesktopSourceStats;
+	 */
+	JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_getStats
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_VideoDesktopSource
+	 * Method:    processFrame
+	 * Signature: (Ljava/nio/ByteBuffer;II[IZ)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_processFrame
+	(JNIEnv *, jobject, jobject, jint, jint, jintArray, jboolean);
+
 	/*
 	 * Class:     dev_onvoid_webrtc_media_video_VideoDesktopSource
 	 * Method:    dispose
@@ -0,0 +1,37 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_video_VideoFrameRing */
+
+#ifndef _Included_dev_onvoid_webrtc_media_video_VideoFrameRing
+#define _Included_dev_onvoid_webrtc_media_video_VideoFrameRing
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_VideoFrameRing
+	 * Method:    getFrameCount
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_video_VideoFrameRing_getFrameCount
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_VideoFrameRing
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoFrameRing_dispose
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_video_VideoFrameRing
+	 * Method:    initialize
+	 * Signature: ([Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;IILdev/onvoid/webrtc/media/video/VideoFrameRing$Format;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoFrameRing_initialize
+	(JNIEnv *, jobject, jobjectArray, jobject, jint, jint, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,45 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_audio_WavAudioFileSink */
+
+#ifndef _Included_dev_onvoid_webrtc_media_audio_WavAudioFileSink
+#define _Included_dev_onvoid_webrtc_media_audio_WavAudioFileSink
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_WavAudioFileSink
+	 * Method:    onRecordedData
+	 * Signature: ([BIIIIII)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSink_onRecordedData
+	(JNIEnv*, jobject, jbyteArray, jint, jint, jint, jint, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_WavAudioFileSink
+	 * Method:    onData
+	 * Signature: ([BIIII)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSink_onData
+	(JNIEnv*, jobject, jbyteArray, jint, jint, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_WavAudioFileSink
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSink_dispose
+	(JNIEnv*, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_WavAudioFileSink
+	 * Method:    initialize
+	 * Signature: (Ljava/lang/String;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSink_initialize
+	(JNIEnv*, jobject, jstring);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,37 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_audio_WavAudioFileSource */
+
+#ifndef _Included_dev_onvoid_webrtc_media_audio_WavAudioFileSource
+#define _Included_dev_onvoid_webrtc_media_audio_WavAudioFileSource
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_WavAudioFileSource
+	 * Method:    onPlaybackData
+	 * Signature: ([BIIII)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSource_onPlaybackData
+	(JNIEnv*, jobject, jbyteArray, jint, jint, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_WavAudioFileSource
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSource_dispose
+	(JNIEnv*, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_WavAudioFileSource
+	 * Method:    initialize
+	 * Signature: (Ljava/lang/String;IIZ)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSource_initialize
+	(JNIEnv*, jobject, jstring, jint, jint, jboolean);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
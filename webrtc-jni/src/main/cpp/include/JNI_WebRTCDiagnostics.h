@@ -0,0 +1,21 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_WebRTCDiagnostics */
+
+#ifndef _Included_dev_onvoid_webrtc_WebRTCDiagnostics
+#define _Included_dev_onvoid_webrtc_WebRTCDiagnostics
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_WebRTCDiagnostics
+	 * Method:    snapshot
+	 * Signature: ()Ldev/onvoid/webrtc/WebRTCDiagnostics;
+	 */
+	JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_WebRTCDiagnostics_snapshot
+	(JNIEnv *, jclass);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -19,6 +19,7 @@
 
 #include "JavaClass.h"
 #include "JavaRef.h"
+#include "rtc/Diagnostics.h"
 
 #include "api/media_stream_interface.h"
 
@@ -48,6 +49,8 @@ namespace jni
 			JavaGlobalRef<jobject> sink;
 
 			const std::shared_ptr<JavaAudioTrackSinkClass> javaClass;
+
+			Diagnostics::InstanceCounter<Diagnostics::Counter::kAudioTrackSinks> instanceCounter;
 	};
 }
 
@@ -19,6 +19,7 @@
 
 #include "JavaClass.h"
 #include "JavaRef.h"
+#include "rtc/Diagnostics.h"
 
 #include "api/peer_connection_interface.h"
 
@@ -73,6 +74,8 @@ namespace jni
 			JavaGlobalRef<jobject> observer;
 
 			const std::shared_ptr<JavaPeerConnectionObserverClass> javaClass;
+
+			Diagnostics::InstanceCounter<Diagnostics::Counter::kPeerConnectionObservers> instanceCounter;
 	};
 }
 
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_API_RTC_BANDWIDTH_ESTIMATION_OBSERVER_H_
+#define JNI_WEBRTC_API_RTC_BANDWIDTH_ESTIMATION_OBSERVER_H_
+
+#include "JavaClass.h"
+#include "JavaRef.h"
+
+#include "api/peer_connection_interface.h"
+#include "api/stats/rtc_stats_collector_callback.h"
+
+#include <jni.h>
+#include <atomic>
+#include <memory>
+
+namespace jni
+{
+	// Reads the send-side bandwidth estimate from the stats of a peer connection at a fixed interval
+	// and notifies the Java observer about significant changes only.
+	class RTCBandwidthEstimationObserver : public webrtc::RTCStatsCollectorCallback
+	{
+		public:
+			RTCBandwidthEstimationObserver(JNIEnv * env, const JavaGlobalRef<jobject> & observer,
+				webrtc::PeerConnectionInterface * pc, int intervalMs);
+			~RTCBandwidthEstimationObserver() = default;
+
+			void start();
+			void stop();
+
+			void OnStatsDelivered(const rtc::scoped_refptr<const webrtc::RTCStatsReport> & report) override;
+
+		private:
+			void poll();
+
+			class JavaRTCBandwidthEstimationObserverClass : public JavaClass
+			{
+				public:
+					explicit JavaRTCBandwidthEstimationObserverClass(JNIEnv * env);
+
+					jmethodID onBandwidthEstimate;
+			};
+
+		private:
+			JavaGlobalRef<jobject> observer;
+
+			const std::shared_ptr<JavaRTCBandwidthEstimationObserverClass> javaClass;
+
+			rtc::scoped_refptr<webrtc::PeerConnectionInterface> pc;
+
+			const int intervalMs;
+			std::atomic<bool> running;
+
+			// Only accessed on the signaling thread.
+			double lastBitrate;
+	};
+}
+
+#endif
@@ -19,6 +19,7 @@
 
 #include "JavaClass.h"
 #include "JavaRef.h"
+#include "rtc/Diagnostics.h"
 
 #include "api/data_channel_interface.h"
 #include <api/DataBufferFactory.h>
@@ -54,6 +55,8 @@ namespace jni
 			std::unique_ptr<DataBufferFactory> bufferFactory;
 
 			const std::shared_ptr<JavaRTCDataChannelObserverClass> javaClass;
+
+			Diagnostics::InstanceCounter<Diagnostics::Counter::kDataChannelObservers> instanceCounter;
 	};
 }
 
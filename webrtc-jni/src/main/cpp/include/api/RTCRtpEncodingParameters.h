@@ -36,11 +36,13 @@ namespace jni
 				jclass cls;
 				jmethodID ctor;
 				jfieldID ssrc;
+				jfieldID rid;
 				jfieldID active;
 				jfieldID minBitrate;
 				jfieldID maxBitrate;
 				jfieldID maxFramerate;
 				jfieldID scaleResolution;
+				jfieldID scalabilityMode;
 		};
 
 		JavaLocalRef<jobject> toJava(JNIEnv * env, const webrtc::RtpEncodingParameters & parameters);
@@ -34,6 +34,7 @@ namespace jni
 
 	namespace I420Buffer
 	{
+		// The returned Java buffer holds a reference to the native buffer.
 		JavaLocalRef<jobject> toJava(JNIEnv * env, const rtc::scoped_refptr<webrtc::I420BufferInterface> & buffer);
 	}
 
@@ -20,6 +20,7 @@
 #include "api/VideoFrame.h"
 #include "JavaClass.h"
 #include "JavaRef.h"
+#include "rtc/Diagnostics.h"
 
 #include "api/video/video_frame.h"
 #include "api/video/video_sink_interface.h"
@@ -52,6 +53,8 @@ namespace jni
 			const std::shared_ptr<JavaVideoTrackSinkClass> javaClass;
 			const std::shared_ptr<JavaVideoFrameClass> javaFrameClass;
 			const std::shared_ptr<JavaNativeI420BufferClass> javaBufferClass;
+
+			Diagnostics::InstanceCounter<Diagnostics::Counter::kVideoTrackSinks> instanceCounter;
 	};
 }
 
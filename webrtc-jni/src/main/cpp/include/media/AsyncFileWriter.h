@@ -0,0 +1,77 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_ASYNC_FILE_WRITER_H_
+#define JNI_WEBRTC_MEDIA_ASYNC_FILE_WRITER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace jni
+{
+	class AsyncFileWriter
+	{
+		public:
+			static const size_t kDefaultBlockSize = 1024 * 1024;
+
+			AsyncFileWriter(const std::string & fileName, size_t blockSize = kDefaultBlockSize, size_t preallocSize = 0);
+			~AsyncFileWriter();
+
+			void write(const void * data, size_t size);
+
+			// Patches are applied when the file is closed, e.g. to finalize container headers.
+			void writeAt(size_t offset, const void * data, size_t size);
+
+			size_t position() const;
+
+			void close();
+
+		private:
+			void run();
+			void pushBlock();
+
+			struct Patch {
+				size_t offset;
+				std::vector<uint8_t> data;
+			};
+
+		private:
+			const size_t blockSize;
+
+			std::FILE * file;
+
+			std::vector<uint8_t> block;
+			std::deque<std::vector<uint8_t>> pending;
+			std::vector<std::vector<uint8_t>> freeBlocks;
+			std::vector<Patch> patches;
+
+			std::atomic<size_t> written;
+			bool closed;
+
+			std::mutex mutex;
+			std::condition_variable condition;
+			std::thread thread;
+	};
+}
+
+#endif
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_BOUNDED_QUEUE_H_
+#define JNI_WEBRTC_MEDIA_BOUNDED_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace jni
+{
+	// Lock-free multi-producer multi-consumer queue with fixed capacity (D. Vyukov).
+	template <typename T>
+	class BoundedQueue
+	{
+		public:
+			// The capacity is rounded up to the next power of two.
+			explicit BoundedQueue(size_t capacity) :
+				mask(roundUp(capacity) - 1),
+				cells(new Cell[mask + 1]),
+				enqueuePos(0),
+				dequeuePos(0)
+			{
+				for (size_t i = 0; i <= mask; ++i) {
+					cells[i].sequence.store(i, std::memory_order_relaxed);
+				}
+			}
+
+			BoundedQueue(const BoundedQueue &) = delete;
+			BoundedQueue & operator=(const BoundedQueue &) = delete;
+
+			bool push(T && value)
+			{
+				Cell * cell;
+				size_t pos = enqueuePos.load(std::memory_order_relaxed);
+
+				while (true) {
+					cell = &cells[pos & mask];
+					size_t seq = cell->sequence.load(std::memory_order_acquire);
+					intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+					if (diff == 0) {
+						if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+							break;
+						}
+					}
+					else if (diff < 0) {
+						// Full.
+						return false;
+					}
+					else {
+						pos = enqueuePos.load(std::memory_order_relaxed);
+					}
+				}
+
+				cell->value = std::move(value);
+				cell->sequence.store(pos + 1, std::memory_order_release);
+
+				return true;
+			}
+
+			bool pop(T & value)
+			{
+				Cell * cell;
+				size_t pos = dequeuePos.load(std::memory_order_relaxed);
+
+				while (true) {
+					cell = &cells[pos & mask];
+					size_t seq = cell->sequence.load(std::memory_order_acquire);
+					intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+					if (diff == 0) {
+						if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+							break;
+						}
+					}
+					else if (diff < 0) {
+						// Empty.
+						return false;
+					}
+					else {
+						pos = dequeuePos.load(std::memory_order_relaxed);
+					}
+				}
+
+				value = std::move(cell->value);
+				cell->sequence.store(pos + mask + 1, std::memory_order_release);
+
+				return true;
+			}
+
+			bool empty() const
+			{
+				return enqueuePos.load(std::memory_order_acquire) == dequeuePos.load(std::memory_order_acquire);
+			}
+
+		private:
+			struct Cell
+			{
+				std::atomic<size_t> sequence;
+				T value;
+			};
+
+			static size_t roundUp(size_t value)
+			{
+				size_t result = 2;
+
+				while (result < value) {
+					result <<= 1;
+				}
+
+				return result;
+			}
+
+		private:
+			const size_t mask;
+			std::unique_ptr<Cell[]> cells;
+
+			// Keep producer and consumer positions on separate cache lines.
+			alignas(64) std::atomic<size_t> enqueuePos;
+			alignas(64) std::atomic<size_t> dequeuePos;
+	};
+}
+
+#endif
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_MAPPED_FILE_H_
+#define JNI_WEBRTC_MEDIA_MAPPED_FILE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace jni
+{
+	// Read-only memory mapping of a file.
+	class MappedFile
+	{
+		public:
+			// Returns the mapping of the file, which is shared by all users of the same file.
+			static std::shared_ptr<MappedFile> open(const std::string & fileName);
+
+			~MappedFile();
+
+			const uint8_t * data() const;
+			size_t size() const;
+
+			// Asks the OS to read the whole file into memory ahead of time.
+			void prefetch() const;
+
+		private:
+			explicit MappedFile(const std::string & fileName);
+
+			MappedFile(const MappedFile &) = delete;
+			MappedFile & operator=(const MappedFile &) = delete;
+
+		private:
+			const uint8_t * address;
+			size_t length;
+
+#if defined(WEBRTC_WIN)
+			void * fileHandle;
+			void * mappingHandle;
+#endif
+	};
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_MEDIA_RECORDER_H_
+#define JNI_WEBRTC_MEDIA_MEDIA_RECORDER_H_
+
+#include "api/frame_transformer_interface.h"
+#include "api/media_types.h"
+#include "api/scoped_refptr.h"
+
+#include "media/audio/OggOpusFileWriter.h"
+#include "media/video/IvfFileWriter.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace jni
+{
+	// Records encoded frames of a RTP receiver before they are passed on to the decoder.
+	class MediaRecorder : public webrtc::FrameTransformerInterface
+	{
+		public:
+			explicit MediaRecorder(cricket::MediaType mediaType);
+			~MediaRecorder();
+
+			// Starts recording to a new file. An active recording is switched over without losing frames.
+			// Audio frames of other payload types than the recorded codec are not written.
+			void start(const std::string & fileName, const std::string & codecName, int channels, int payloadType);
+			void stop();
+			bool isRecording();
+
+			// The RTP payload type of the last received frame, or -1 if unknown.
+			int getPayloadType() const;
+
+			// FrameTransformerInterface implementation.
+			void Transform(std::unique_ptr<webrtc::TransformableFrameInterface> frame) override;
+			void RegisterTransformedFrameCallback(rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback) override;
+			void RegisterTransformedFrameSinkCallback(rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback, uint32_t ssrc) override;
+			void UnregisterTransformedFrameCallback() override;
+			void UnregisterTransformedFrameSinkCallback(uint32_t ssrc) override;
+
+		private:
+			const cricket::MediaType mediaType;
+
+			std::atomic<int> payloadType;
+			int recordPayloadType;
+
+			std::unique_ptr<IvfFileWriter> videoWriter;
+			std::unique_ptr<OggOpusFileWriter> audioWriter;
+
+			rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback;
+			std::map<uint32_t, rtc::scoped_refptr<webrtc::TransformedFrameCallback>> sinkCallbacks;
+
+			std::mutex writerMutex;
+			std::mutex callbackMutex;
+	};
+}
+
+#endif
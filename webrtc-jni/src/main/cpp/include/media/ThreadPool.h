@@ -0,0 +1,58 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_THREAD_POOL_H_
+#define JNI_WEBRTC_MEDIA_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace jni
+{
+	class ThreadPool
+	{
+		public:
+			explicit ThreadPool(size_t threads);
+			~ThreadPool();
+
+			// Shared pool with one thread per core, created on first use.
+			static ThreadPool & shared();
+
+			size_t size() const;
+
+			// Calls func(0) ... func(count - 1) in parallel, the calling thread takes part.
+			// Returns when all calls have returned.
+			void parallelFor(size_t count, const std::function<void(size_t)> & func);
+
+		private:
+			void run();
+
+		private:
+			std::vector<std::thread> threads;
+			std::deque<std::function<void()>> tasks;
+
+			std::mutex mutex;
+			std::condition_variable condition;
+
+			bool stopped;
+	};
+}
+
+#endif
@@ -35,13 +35,16 @@ namespace jni
 
 			virtual void convert(const int16_t * src, size_t srcSize, int16_t * dst, size_t dstSize) = 0;
 
+			// Converts consecutive 10 ms frames, the output frames are packed without gaps.
+			// Returns the number of output samples.
+			size_t convertFrames(const int16_t * src, size_t srcSize, int16_t * dst, size_t dstCapacity);
+
 			size_t getSrcChannels() const { return srcChannels; }
 			size_t getSrcFrames() const { return srcFrames; }
 			size_t getDstChannels() const { return dstChannels; }
 			size_t getDstFrames() const { return dstFrames; }
 
 		protected:
-			AudioConverter();
 			AudioConverter(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels);
 
 			void checkSizes(size_t srcSize, size_t dstCapacity) const;
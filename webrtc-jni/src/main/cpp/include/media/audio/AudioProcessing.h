@@ -38,6 +38,13 @@ namespace jni
 		};
 
 		void updateStats(const webrtc::AudioProcessingStats & stats, JNIEnv * env, const JavaRef<jobject> & javaType);
+
+		// Writes the per-frame stats in the layout of the Java AudioProcessingFrameStats buffer.
+		void writeFrameStats(const webrtc::AudioProcessingStats & stats, int32_t * dst);
+
+		// Processes consecutive 10 ms frames, the output frames are packed without gaps.
+		int process(webrtc::AudioProcessing * apm, const int16_t * src, const webrtc::StreamConfig & srcConfig,
+			const webrtc::StreamConfig & dstConfig, int16_t * dst, size_t frames, bool reverse);
 	}
 }
 
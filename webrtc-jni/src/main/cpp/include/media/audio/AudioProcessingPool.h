@@ -0,0 +1,106 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_PROCESSING_POOL_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_PROCESSING_POOL_H_
+
+#include "media/BoundedQueue.h"
+
+#include "api/scoped_refptr.h"
+#include "modules/audio_processing/include/audio_processing.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace jni
+{
+	// Processes frames of many AudioProcessing instances on a fixed set of worker threads.
+	// All frames of a stream are processed in order by the same worker.
+	class AudioProcessingPool
+	{
+		public:
+			struct Completion
+			{
+				int64_t tag;
+				int32_t streamId;
+				int32_t result;
+			};
+
+			AudioProcessingPool(size_t threads, size_t queueSize);
+			~AudioProcessingPool();
+
+			int addStream(rtc::scoped_refptr<webrtc::AudioProcessing> apm, const webrtc::StreamConfig & inputConfig, const webrtc::StreamConfig & outputConfig);
+			void removeStream(int streamId);
+
+			// Returns false if the queue of the stream's worker is full.
+			bool submit(int streamId, const int16_t * src, size_t srcSize, int16_t * dst, size_t dstSize, size_t frames, int64_t tag);
+			bool poll(Completion & completion);
+
+		private:
+			struct Stream
+			{
+				int id;
+				rtc::scoped_refptr<webrtc::AudioProcessing> apm;
+				webrtc::StreamConfig inputConfig;
+				webrtc::StreamConfig outputConfig;
+			};
+
+			struct Task
+			{
+				std::shared_ptr<Stream> stream;
+				const int16_t * src;
+				int16_t * dst;
+				size_t frames;
+				int64_t tag;
+			};
+
+			struct Worker
+			{
+				explicit Worker(size_t queueSize) : tasks(queueSize), idle(false) {}
+
+				BoundedQueue<Task> tasks;
+				std::atomic<bool> idle;
+				std::mutex mutex;
+				std::condition_variable condition;
+				std::thread thread;
+			};
+
+			void run(Worker * worker);
+
+		private:
+			std::vector<std::unique_ptr<Worker>> workers;
+			BoundedQueue<Completion> completions;
+
+			// Workers block on a full completion queue until results are polled.
+			std::mutex completionMutex;
+			std::condition_variable completionCondition;
+			std::atomic<int> completionWaiters;
+			uint64_t completionsTaken;
+
+			std::map<int, std::shared_ptr<Stream>> streams;
+			std::mutex streamMutex;
+			int nextStreamId;
+
+			std::atomic<bool> running;
+	};
+}
+
+#endif
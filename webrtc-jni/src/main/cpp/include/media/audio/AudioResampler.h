@@ -0,0 +1,53 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_RESAMPLER_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_RESAMPLER_H_
+
+#include "common_audio/resampler/include/push_resampler.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace jni
+{
+	class AudioResampler
+	{
+		public:
+			AudioResampler();
+			~AudioResampler() = default;
+
+			void reset(int sourceRate, int targetRate, int channels);
+
+			// Resamples consecutive 10 ms blocks. Returns the number of output samples, or -1 on error.
+			int resample(const int16_t * src, size_t srcSamples, int16_t * dst, size_t dstSamples);
+			int resample(const float * src, size_t srcSamples, float * dst, size_t dstSamples);
+
+		private:
+			template <typename T>
+			int resample(webrtc::PushResampler<T> & resampler, const T * src, size_t srcSamples, T * dst, size_t dstSamples);
+
+		private:
+			webrtc::PushResampler<int16_t> resampler16;
+			webrtc::PushResampler<float> resamplerFloat;
+
+			int sourceRate;
+			int targetRate;
+			int channels;
+	};
+}
+
+#endif
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_OGG_OPUS_FILE_WRITER_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_OGG_OPUS_FILE_WRITER_H_
+
+#include "media/AsyncFileWriter.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace jni
+{
+	class OggOpusFileWriter
+	{
+		public:
+			OggOpusFileWriter(const std::string & fileName, uint8_t channels);
+			~OggOpusFileWriter();
+
+			void writePacket(const uint8_t * data, size_t size, uint32_t rtpTimestamp);
+			void close();
+
+		private:
+			void writePage(const uint8_t * data, size_t size, uint64_t granule, uint8_t flags);
+			void flushPacket(bool last);
+
+		private:
+			AsyncFileWriter writer;
+
+			uint32_t serial;
+			uint32_t sequence;
+
+			// One packet is held back to flag the last page on close.
+			std::vector<uint8_t> packet;
+			uint64_t packetGranule;
+			bool hasPacket;
+
+			bool started;
+			uint32_t lastRtpTimestamp;
+			int64_t timestamp;
+
+			std::vector<uint8_t> page;
+
+			bool closed;
+	};
+}
+
+#endif
@@ -18,9 +18,8 @@
 #define JNI_WEBRTC_MEDIA_RAW_AUDIO_FILE_SINK_H_
 
 #include "AudioSink.h"
+#include "media/AsyncFileWriter.h"
 
-#include <fstream>
-#include <memory>
 #include <string>
 
 namespace jni
@@ -44,7 +43,7 @@ namespace jni
 			uint32_t & newMicLevel) override;
 
 		private:
-			std::ofstream outputStream;
+			AsyncFileWriter writer;
 	};
 }
 
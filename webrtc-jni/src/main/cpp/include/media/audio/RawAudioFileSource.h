@@ -18,16 +18,18 @@
 #define JNI_WEBRTC_MEDIA_RAW_AUDIO_FILE_SOURCE_H_
 
 #include "AudioSource.h"
+#include "media/MappedFile.h"
 
-#include <fstream>
+#include <memory>
 #include <string>
 
 namespace jni
 {
+	// Plays raw PCM audio from a memory mapped file. Sources of the same file share one mapping.
 	class RawAudioFileSource : public AudioSource
 	{
 		public:
-			RawAudioFileSource(std::string fileName);
+			RawAudioFileSource(std::string fileName, bool loop = false);
 			~RawAudioFileSource();
 
 			int32_t NeedMorePlayData(
@@ -41,10 +43,10 @@ namespace jni
 				int64_t * ntp_time_ms) override;
 
 		private:
-			std::ifstream inputStream;
-			size_t fileLength;
-			size_t fileRemainingBytes;
+			std::shared_ptr<MappedFile> file;
+			size_t position;
+			const bool loop;
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -18,28 +18,30 @@
 #define JNI_WEBRTC_MEDIA_WAV_AUDIO_FILE_SINK_H_
 
 #include "AudioSink.h"
+#include "media/AsyncFileWriter.h"
+#include "media/audio/AudioConverter.h"
 
-#include "common_audio/wav_file.h"
+#include "api/media_stream_interface.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
-
-#if defined(WEBRTC_MAC)
-#define MAYBE_CPP DISABLED_CPP
-#define MAYBE_CPPFileDescriptor DISABLED_CPPFileDescriptor
-#else
-#define MAYBE_CPP CPP
-#define MAYBE_CPPFileDescriptor CPPFileDescriptor
-#endif
+#include <vector>
 
 namespace jni
 {
-	class WavAudioFileSink : public AudioSink
+	// Writes 16-bit PCM audio to a WAV file. The file format is taken from the first
+	// received audio frame, later format changes are converted to the file format.
+	class WavAudioFileSink : public AudioSink, public webrtc::AudioTrackSinkInterface
 	{
 		public:
+			// Throws an Exception if the file cannot be created.
 			WavAudioFileSink(std::string fileName);
 			~WavAudioFileSink();
 
+			void close();
+
+			// AudioTransport implementation.
 			int32_t RecordedDataIsAvailable(
 				const void * audioSamples,
 				const size_t nSamples,
@@ -52,9 +54,28 @@ namespace jni
 				const bool keyPressed,
 				uint32_t & newMicLevel) override;
 
+			// AudioTrackSinkInterface implementation.
+			void OnData(const void * data, int bitsPerSample, int sampleRate, size_t channels, size_t frames) override;
+
+		private:
+			void write(const int16_t * samples, size_t frames, size_t channels, uint32_t sampleRate);
+			void writeHeader(bool finalize);
+
 		private:
-			std::unique_ptr<webrtc::WavWriter> wavWriter;
+			const std::string fileName;
+
+			std::unique_ptr<AsyncFileWriter> writer;
+			std::unique_ptr<AudioConverter> converter;
+			std::vector<int16_t> buffer;
+
+			uint32_t sampleRate;
+			size_t channels;
+			size_t dataSize;
+
+			bool closed;
+
+			std::mutex mutex;
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
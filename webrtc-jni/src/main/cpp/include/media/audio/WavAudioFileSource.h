@@ -19,25 +19,18 @@
 
 #include "AudioSource.h"
 
-#include "common_audio/wav_file.h"
-
 #include <memory>
 #include <string>
-
-#if defined(WEBRTC_MAC)
-#define MAYBE_CPP DISABLED_CPP
-#define MAYBE_CPPFileDescriptor DISABLED_CPPFileDescriptor
-#else
-#define MAYBE_CPP CPP
-#define MAYBE_CPPFileDescriptor CPPFileDescriptor
-#endif
+#include <vector>
 
 namespace jni
 {
+	// Plays a WAV file which is converted to the playout format when loaded. The converted
+	// audio is cached in memory and shared by all sources of the same file and format.
 	class WavAudioFileSource : public AudioSource
 	{
 		public:
-			WavAudioFileSource(std::string fileName);
+			WavAudioFileSource(std::string fileName, uint32_t sampleRate = 48000, size_t channels = 2, bool loop = false);
 			~WavAudioFileSource();
 
 			int32_t NeedMorePlayData(
@@ -51,8 +44,18 @@ namespace jni
 				int64_t * ntp_time_ms) override;
 
 		private:
-			std::unique_ptr<webrtc::WavReader> wavReader;
+			static std::shared_ptr<const std::vector<int16_t>> load(const std::string & fileName, uint32_t sampleRate, size_t channels);
+
+		private:
+			std::shared_ptr<const std::vector<int16_t>> samples;
+			size_t position;
+
+			const uint32_t sampleRate;
+			const size_t channels;
+			const bool loop;
+
+			bool formatMismatch;
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_VIDEO_I420_BUFFER_POOL_H_
+#define JNI_WEBRTC_MEDIA_VIDEO_I420_BUFFER_POOL_H_
+
+#include "api/video/i420_buffer.h"
+#include "rtc_base/ref_counted_object.h"
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace jni
+{
+	// Recycles I420 buffers per resolution. Buffers return to the pool when their last external reference is released.
+	class I420BufferPool
+	{
+		public:
+			static const size_t kDefaultMaxBuffers = 8;
+			static const size_t kMaxResolutions = 8;
+
+			struct Stats
+			{
+				// Number of buffers retained by the pool, whether in use or free, and of unpooled
+				// buffers still in use. Buffers in use of a resolution dropped from the pool are
+				// not counted.
+				size_t buffers;
+				size_t bytes;
+			};
+
+			explicit I420BufferPool(size_t maxBuffers = kDefaultMaxBuffers);
+			~I420BufferPool() = default;
+
+			// Shared by the video sources and NativeI420Buffer.allocate().
+			static I420BufferPool & shared();
+
+			// Falls back to an unpooled buffer if all buffers of the resolution are in use.
+			rtc::scoped_refptr<webrtc::I420Buffer> create(int width, int height);
+
+			// Shrinking drops free buffers only, buffers in use are dropped after their release.
+			void setMaxBuffers(size_t maxBuffers);
+			size_t getMaxBuffers();
+			// Drops all free buffers.
+			void release();
+
+			Stats getStats();
+
+		private:
+			using PooledBuffer = rtc::RefCountedObject<webrtc::I420Buffer>;
+
+			struct Entry
+			{
+				uint64_t lastUse;
+				// A buffer is free when the pool holds the only reference.
+				std::list<rtc::scoped_refptr<PooledBuffer>> buffers;
+			};
+
+			void dropFreeBuffers(Entry & entry, size_t maxBuffers);
+
+			std::map<uint64_t, Entry> pools;
+			std::mutex mutex;
+
+			size_t maxBuffers;
+			uint64_t useCounter;
+
+			// Unpooled buffers still in use.
+			std::atomic<size_t> unpooledBuffers;
+			std::atomic<size_t> unpooledBytes;
+	};
+}
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_IVF_FILE_WRITER_H_
+#define JNI_WEBRTC_MEDIA_IVF_FILE_WRITER_H_
+
+#include "media/AsyncFileWriter.h"
+
+#include <cstdint>
+#include <string>
+
+namespace jni
+{
+	class IvfFileWriter
+	{
+		public:
+			IvfFileWriter(const std::string & fileName, const std::string & codecName);
+			~IvfFileWriter();
+
+			void writeFrame(const uint8_t * data, size_t size, uint32_t rtpTimestamp, bool keyFrame, uint16_t width, uint16_t height);
+			void close();
+
+		private:
+			void writeHeader(bool finalize);
+
+		private:
+			static const uint32_t kTimebase = 90000;
+
+			// Initialized before the writer to reject unsupported codecs without creating the file.
+			const uint32_t fourCC;
+
+			AsyncFileWriter writer;
+
+			uint16_t width;
+			uint16_t height;
+			uint32_t frameCount;
+
+			bool started;
+			uint32_t lastRtpTimestamp;
+			int64_t timestamp;
+
+			bool closed;
+	};
+}
+
+#endif
@@ -18,10 +18,11 @@
 #define JNI_WEBRTC_MEDIA_RAW_VIDEO_FILE_SINK_H_
 
 #include "VideoSink.h"
+#include "media/AsyncFileWriter.h"
 
-#include <fstream>
-#include <memory>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace jni
 {
@@ -35,7 +36,9 @@ namespace jni
 			void OnDiscardedFrame() override;
 
 		private:
-			std::ofstream outputStream;
+			AsyncFileWriter writer;
+
+			std::vector<uint8_t> buffer;
 	};
 }
 
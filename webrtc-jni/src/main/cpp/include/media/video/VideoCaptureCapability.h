@@ -44,9 +44,14 @@ namespace jni
 
 				jclass cls;
 				jmethodID ctor;
+				jfieldID width;
+				jfieldID height;
+				jfieldID frameRate;
+				jfieldID videoType;
 		};
 
 		JavaLocalRef<jobject> toJava(JNIEnv * env, const avdev::VideoCaptureCapability & capability);
+		webrtc::VideoCaptureCapability toNative(JNIEnv * env, const JavaRef<jobject> & javaType);
 	}
 }
 
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_VIDEO_DESKTOP_SOURCE_STATS_H_
+#define JNI_WEBRTC_MEDIA_VIDEO_DESKTOP_SOURCE_STATS_H_
+
+#include "media/video/VideoTrackDesktopSource.h"
+#include "JavaClass.h"
+#include "JavaRef.h"
+
+#include <jni.h>
+
+namespace jni
+{
+	namespace VideoDesktopSourceStats
+	{
+		class JavaVideoDesktopSourceStatsClass : public JavaClass
+		{
+			public:
+				explicit JavaVideoDesktopSourceStatsClass(JNIEnv * env);
+
+				jclass cls;
+				jmethodID ctor;
+		};
+
+		JavaLocalRef<jobject> toJava(JNIEnv * env, const VideoTrackDesktopSource::Stats & stats);
+	}
+}
+
+#endif
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef JNI_WEBRTC_MEDIA_VIDEO_FRAME_RING_H_
+#define JNI_WEBRTC_MEDIA_VIDEO_FRAME_RING_H_
+
+#include "JavaRef.h"
+
+#include "api/scoped_refptr.h"
+#include "api/video/video_frame.h"
+#include "api/video/video_sink_interface.h"
+#include "rtc_base/ref_count.h"
+
+#include <jni.h>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace jni
+{
+	// Writes video frames round-robin into a fixed set of Java direct buffers, without allocations per frame.
+	class VideoFrameRing : public rtc::RefCountInterface
+	{
+		public:
+			// In the order of the Java VideoFrameRing.Format enum.
+			enum class Format
+			{
+				kI420,
+				kNV12
+			};
+
+			VideoFrameRing(JNIEnv * env, const JavaRef<jobjectArray> & slots, const JavaRef<jobject> & timestamps,
+				int width, int height, Format format);
+			~VideoFrameRing() = default;
+
+			static size_t frameSize(int width, int height);
+
+			// Frames of other sizes are scaled to the ring size.
+			void write(const webrtc::VideoFrame & frame);
+
+			int64_t getFrameCount() const;
+
+		private:
+			const int width;
+			const int height;
+			const Format format;
+
+			std::vector<JavaGlobalRef<jobject>> slotRefs;
+			std::vector<uint8_t *> slots;
+
+			JavaGlobalRef<jobject> timestampsRef;
+			int64_t * timestamps;
+
+			std::atomic<int64_t> frameCount;
+	};
+
+
+	// Capture sink keeping the ring alive while frames are delivered.
+	class VideoFrameRingSink : public rtc::VideoSinkInterface<webrtc::VideoFrame>
+	{
+		public:
+			explicit VideoFrameRingSink(const rtc::scoped_refptr<VideoFrameRing> & ring);
+			~VideoFrameRingSink() = default;
+
+			// VideoSinkInterface implementation.
+			void OnFrame(const webrtc::VideoFrame & frame) override;
+
+		private:
+			rtc::scoped_refptr<VideoFrameRing> ring;
+	};
+}
+
+#endif
@@ -17,16 +17,31 @@
 #ifndef JNI_WEBRTC_MEDIA_VIDEO_TRACK_DESKTOP_SOURCE_H_
 #define JNI_WEBRTC_MEDIA_VIDEO_TRACK_DESKTOP_SOURCE_H_
 
+#include "media/video/desktop/DesktopFrameConverter.h"
+
 #include "api/video/i420_buffer.h"
 #include "media/base/adapted_video_track_source.h"
 #include "modules/desktop_capture/desktop_capturer.h"
+#include "modules/desktop_capture/desktop_region.h"
 #include "rtc_base/thread.h"
 
+#include <atomic>
+#include <mutex>
+
 namespace jni
 {
 	class VideoTrackDesktopSource : public rtc::AdaptedVideoTrackSource, public webrtc::DesktopCapturer::Callback
 	{
 		public:
+			struct Stats
+			{
+				// Achieved capture rate and the average capture and conversion time per frame, over the last second.
+				double frameRate = 0;
+				double captureTimeMs = 0;
+				uint64_t framesCaptured = 0;
+				uint64_t framesSkipped = 0;
+			};
+
 			VideoTrackDesktopSource();
 			~VideoTrackDesktopSource();
 
@@ -34,11 +49,19 @@ namespace jni
 			void setFrameRate(const uint16_t frameRate);
 			void setMaxFrameSize(webrtc::DesktopSize size);
 			void setFocusSelectedSource(bool focus);
+			void setConversionStripes(int stripes);
 
 			void start();
 			void stop();
 			void terminate();
 
+			Stats getStats();
+
+			// Processes a frame as if it was captured, used for testing. With drop set
+			// the frame is handled like a frame dropped by the video adapter. Returns false
+			// if the source is capturing.
+			bool processFrame(std::unique_ptr<webrtc::DesktopFrame> frame, bool drop);
+
 			// AdaptedVideoTrackSource implementation.
 			virtual bool is_screencast() const override;
 			virtual absl::optional<bool> needs_denoising() const override;
@@ -50,11 +73,18 @@ namespace jni
 
 		private:
 			void capture();
-			void process(std::unique_ptr<webrtc::DesktopFrame> & frame);
+			void captureFrame();
+			void updateStats(int64_t time, int64_t captureTime, uint64_t skipped);
+			void process(std::unique_ptr<webrtc::DesktopFrame> & frame, bool drop = false);
+			void deliverFrame(const rtc::scoped_refptr<webrtc::VideoFrameBuffer> & frameBuffer, int64_t time);
+			void repeatLastFrame(int64_t time);
+
+		private:
+			static const int64_t kRepeatIntervalUs = 1000000;
 
 		private:
 			uint16_t frameRate;
-			bool isCapturing;
+			std::atomic<bool> isCapturing;
 			bool focusSelectedSource;
 
 			webrtc::DesktopSize maxFrameSize;
@@ -64,11 +94,26 @@ namespace jni
 			webrtc::DesktopCapturer::SourceId sourceId;
 			bool sourceIsWindow;
 
-			std::unique_ptr<webrtc::DesktopFrame> lastFrame;
-
 			std::unique_ptr<rtc::Thread> captureThread;
-
-			rtc::scoped_refptr<webrtc::I420Buffer> buffer;
+			std::unique_ptr<webrtc::DesktopCapturer> capturer;
+			DesktopFrameConverter converter;
+
+			// Last converted frame, used to convert only the changed areas of the next frame.
+			rtc::scoped_refptr<webrtc::I420Buffer> convertedBuffer;
+			webrtc::DesktopRect convertedRect;
+			// Areas changed since the last delivered frame, in frame coordinates.
+			webrtc::DesktopRegion pendingDamage;
+			bool damageReported;
+
+			rtc::scoped_refptr<webrtc::VideoFrameBuffer> lastBuffer;
+			int64_t lastFrameTime;
+			int64_t nextFrameTime;
+
+			Stats stats;
+			int64_t statsWindowStart;
+			uint64_t windowFrames;
+			int64_t windowCaptureTime;
+			std::mutex statsMutex;
 	};
 }
 
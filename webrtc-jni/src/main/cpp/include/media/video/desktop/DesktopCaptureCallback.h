@@ -18,6 +18,7 @@
 #define JNI_WEBRTC_MEDIA_DESKTOP_CAPTURE_CALLBACK_H_
 
 #include "api/VideoFrame.h"
+#include "media/video/desktop/DesktopFrameConverter.h"
 #include "JavaClass.h"
 #include "JavaRef.h"
 
@@ -52,7 +53,7 @@ namespace jni
 			const std::shared_ptr<JavaDesktopCaptureCallbackClass> javaClass;
 			const std::shared_ptr<JavaVideoFrameClass> javaFrameClass;
 
-			rtc::scoped_refptr<webrtc::I420Buffer> i420Buffer;
+			DesktopFrameConverter converter;
 	};
 }
 
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef JNI_WEBRTC_MEDIA_DESKTOP_FRAME_CONVERTER_H_
+#define JNI_WEBRTC_MEDIA_DESKTOP_FRAME_CONVERTER_H_
+
+#include "api/video/i420_buffer.h"
+#include "modules/desktop_capture/desktop_frame.h"
+#include "modules/desktop_capture/desktop_geometry.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace jni
+{
+	// Converts ARGB desktop frames to I420 in horizontal stripes on the shared thread pool.
+	class DesktopFrameConverter
+	{
+		public:
+			// With 0 stripes, one stripe per core is used.
+			explicit DesktopFrameConverter(int stripes = 0);
+			~DesktopFrameConverter() = default;
+
+			void setStripes(int stripes);
+
+			// Converts the rect, relative to the crop origin, into the same position of the buffer.
+			bool convert(const webrtc::DesktopFrame & frame, const webrtc::DesktopRect & cropRect,
+				const webrtc::DesktopRect & rect, webrtc::I420Buffer & buffer);
+
+			// Scales the cropped frame to the buffer size and converts it in the same pass. Only the
+			// rect of the buffer is written, the full-size frame is never converted.
+			bool convertScaled(const webrtc::DesktopFrame & frame, const webrtc::DesktopRect & cropRect,
+				const webrtc::DesktopRect & rect, webrtc::I420Buffer & buffer);
+
+			// Maps a rect of the source to the area of the scaled frame it affects.
+			static webrtc::DesktopRect scaleRect(const webrtc::DesktopRect & rect,
+				const webrtc::DesktopSize & srcSize, const webrtc::DesktopSize & dstSize);
+
+		private:
+			int stripeHeight(int height) const;
+
+		private:
+			std::atomic<int> stripes;
+
+			// Scaled ARGB rows, each stripe uses its own range.
+			std::vector<uint8_t> scaled;
+	};
+}
+
+#endif
@@ -20,6 +20,8 @@
 #include "media/video/VideoDeviceManager.h"
 
 #include <atomic>
+#include <map>
+#include <mutex>
 #include <thread>
 #include <libudev.h>
 
@@ -40,6 +42,8 @@ namespace jni
 				void addDevice(const std::string & name, const std::string & descriptor);
 				void removeDevice(const std::string & name, const std::string & descriptor);
 				void run();
+				std::set<VideoCaptureCapability> queryCapabilities(const VideoDevice & device);
+				void invalidateCapabilities(const std::string & descriptor);
 				bool checkDevice(const std::string & descriptor);
 				int ioctlDevice(int fh, int request, void * arg);
 				webrtc::VideoType toVideoType(const std::uint32_t & v4l2MediaType);
@@ -53,6 +57,12 @@ namespace jni
 				std::thread thread;
 				std::atomic<bool> running;
 				struct udev * udev;
+
+				// Enumerating the formats is slow on some cameras, cached per device node.
+				std::map<std::string, std::set<VideoCaptureCapability>> capabilityCache;
+				// Incremented on each invalidation, to discard results of concurrent queries.
+				uint64_t cacheGeneration;
+				std::mutex cacheMutex;
 		};
 	}
 }
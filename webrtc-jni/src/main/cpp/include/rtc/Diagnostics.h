@@ -0,0 +1,80 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef JNI_WEBRTC_RTC_DIAGNOSTICS_H_
+#define JNI_WEBRTC_RTC_DIAGNOSTICS_H_
+
+#include "JavaClass.h"
+#include "JavaRef.h"
+
+#include <jni.h>
+#include <cstdint>
+
+namespace jni
+{
+	namespace Diagnostics
+	{
+		enum class Counter : int
+		{
+			kPeerConnections,
+			kPeerConnectionObservers,
+			kDataChannelObservers,
+			kVideoTrackSinks,
+			kAudioTrackSinks,
+			kCount
+		};
+
+		void increment(Counter counter);
+		void decrement(Counter counter);
+		int64_t get(Counter counter);
+
+		// Counts the live instances of the class it is a member of.
+		template <Counter C>
+		class InstanceCounter
+		{
+			public:
+				InstanceCounter()
+				{
+					increment(C);
+				}
+
+				InstanceCounter(const InstanceCounter &)
+				{
+					increment(C);
+				}
+
+				~InstanceCounter()
+				{
+					decrement(C);
+				}
+
+				InstanceCounter & operator=(const InstanceCounter &) = default;
+		};
+
+		class JavaWebRTCDiagnosticsClass : public JavaClass
+		{
+			public:
+				explicit JavaWebRTCDiagnosticsClass(JNIEnv * env);
+
+				jclass cls;
+				jmethodID ctor;
+		};
+
+		// Takes a snapshot of all counters. The counters are read one by one, not atomically as a whole.
+		JavaLocalRef<jobject> toJava(JNIEnv * env);
+	}
+}
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef JNI_WEBRTC_RTC_EMULATED_NETWORK_H_
+#define JNI_WEBRTC_RTC_EMULATED_NETWORK_H_
+
+#include "p2p/base/port_allocator.h"
+#include "rtc_base/network.h"
+#include "rtc_base/packet_socket_factory.h"
+#include "rtc_base/thread.h"
+
+#include <memory>
+
+namespace jni
+{
+	// The network of one emulated peer. Owned by the NetworkEmulation which created it.
+	class EmulatedNetwork
+	{
+		public:
+			EmulatedNetwork(rtc::Thread * networkThread, rtc::NetworkManager * networkManager);
+			~EmulatedNetwork() = default;
+
+			rtc::Thread * getNetworkThread() const;
+
+			// Creates an allocator gathering candidates on the emulated network only.
+			std::unique_ptr<cricket::PortAllocator> createPortAllocator() const;
+
+		private:
+			rtc::Thread * networkThread;
+			rtc::NetworkManager * networkManager;
+			std::unique_ptr<rtc::PacketSocketFactory> socketFactory;
+	};
+}
+
+#endif
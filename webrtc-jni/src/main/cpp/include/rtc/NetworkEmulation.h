@@ -0,0 +1,84 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef JNI_WEBRTC_RTC_NETWORK_EMULATION_H_
+#define JNI_WEBRTC_RTC_NETWORK_EMULATION_H_
+
+#if defined(WEBRTC_NETWORK_EMULATION)
+
+#include "JavaClass.h"
+#include "JavaRef.h"
+#include "rtc/EmulatedNetwork.h"
+
+#include "api/test/network_emulation_manager.h"
+#include "api/test/simulated_network.h"
+
+#include <jni.h>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace jni
+{
+	// Connects emulated networks by simulated links with configurable delay, loss and capacity.
+	class NetworkEmulation
+	{
+		public:
+			NetworkEmulation();
+			~NetworkEmulation() = default;
+
+			EmulatedNetwork * createNetwork();
+
+			void createLink(EmulatedNetwork * from, EmulatedNetwork * to, const webrtc::BuiltInNetworkBehaviorConfig & config);
+			void updateLink(EmulatedNetwork * from, EmulatedNetwork * to, const webrtc::BuiltInNetworkBehaviorConfig & config);
+
+		private:
+			webrtc::EmulatedEndpoint * getEndpoint(EmulatedNetwork * network) const;
+
+		private:
+			using Simulation = decltype(webrtc::NetworkEmulationManager::SimulatedNetworkNode::simulation);
+			using Link = std::pair<EmulatedNetwork *, EmulatedNetwork *>;
+
+			std::unique_ptr<webrtc::NetworkEmulationManager> manager;
+			std::vector<std::unique_ptr<EmulatedNetwork>> networks;
+			std::map<EmulatedNetwork *, webrtc::EmulatedEndpoint *> endpoints;
+			std::map<Link, Simulation> links;
+	};
+
+	namespace NetworkEmulationConfig
+	{
+		class JavaNetworkEmulationConfigClass : public JavaClass
+		{
+			public:
+				explicit JavaNetworkEmulationConfigClass(JNIEnv * env);
+
+				jclass cls;
+				jfieldID queueLengthPackets;
+				jfieldID queueDelayMs;
+				jfieldID delayStandardDeviationMs;
+				jfieldID linkCapacityKbps;
+				jfieldID lossPercent;
+				jfieldID allowReordering;
+				jfieldID avgBurstLossLength;
+		};
+
+		webrtc::BuiltInNetworkBehaviorConfig toNative(JNIEnv * env, const JavaRef<jobject> & javaType);
+	}
+}
+
+#endif
+
+#endif
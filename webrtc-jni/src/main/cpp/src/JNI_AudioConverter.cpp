@@ -16,6 +16,7 @@
 
 #include "JNI_AudioConverter.h"
 #include "media/audio/AudioConverter.h"
+#include "JavaError.h"
 #include "JavaUtils.h"
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convertInternal
@@ -24,21 +25,31 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convert
 	jni::AudioConverter * converter = GetHandle<jni::AudioConverter>(env, caller);
 	CHECK_HANDLE(converter);
 
-	jboolean isDstCopy = JNI_FALSE;
+	// Access the arrays without copying, no JNI calls are allowed until released.
+	jbyte * srcPtr = static_cast<jbyte *>(env->GetPrimitiveArrayCritical(src, nullptr));
+	jbyte * dstPtr = static_cast<jbyte *>(env->GetPrimitiveArrayCritical(dst, nullptr));
 
-	jbyte * srcPtr = env->GetByteArrayElements(src, nullptr);
-	jbyte * dstPtr = env->GetByteArrayElements(dst, &isDstCopy);
+	converter->convertFrames(reinterpret_cast<const int16_t *>(srcPtr), nSrcSamples, reinterpret_cast<int16_t *>(dstPtr), nDstSamples);
 
-	converter->convert(reinterpret_cast<const int16_t *>(srcPtr), nSrcSamples, reinterpret_cast<int16_t *>(dstPtr), nDstSamples);
+	env->ReleasePrimitiveArrayCritical(dst, dstPtr, 0);
+	env->ReleasePrimitiveArrayCritical(src, srcPtr, JNI_ABORT);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convertDirect
+(JNIEnv * env, jobject caller, jobject src, jint nSrcSamples, jobject dst, jint nDstSamples)
+{
+	jni::AudioConverter * converter = GetHandle<jni::AudioConverter>(env, caller);
+	CHECK_HANDLE(converter);
 
-	if (isDstCopy == JNI_TRUE) {
-		jsize dstLength = env->GetArrayLength(dst);
+	auto srcPtr = static_cast<const int16_t *>(env->GetDirectBufferAddress(src));
+	auto dstPtr = static_cast<int16_t *>(env->GetDirectBufferAddress(dst));
 
-		env->SetByteArrayRegion(dst, 0, dstLength, dstPtr);
+	if (srcPtr == nullptr || dstPtr == nullptr) {
+		env->Throw(jni::JavaError(env, "Buffers must be direct buffers"));
+		return;
 	}
 
-	env->ReleaseByteArrayElements(src, srcPtr, JNI_ABORT);
-	env->ReleaseByteArrayElements(dst, dstPtr, JNI_ABORT);
+	converter->convertFrames(srcPtr, nSrcSamples, dstPtr, nDstSamples);
 }
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_dispose
@@ -25,7 +25,9 @@
 #include "JavaUtils.h"
 #include "media/audio/AudioDevice.h"
 #include "media/audio/AudioTransportSink.h"
+#include "media/audio/AudioSource.h"
 #include "media/audio/AudioTransportSource.h"
+#include "media/audio/WavAudioFileSink.h"
 
 #include "api/scoped_refptr.h"
 #include "api/task_queue/default_task_queue_factory.h"
@@ -415,6 +417,32 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_remo
 	}
 }
 
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_addFileSinkInternal
+(JNIEnv * env, jobject caller, jobject jSink)
+{
+	webrtc::AudioDeviceModule * audioModule = GetHandle<webrtc::AudioDeviceModule>(env, caller);
+	CHECK_HANDLEV(audioModule, 0);
+
+	jni::WavAudioFileSink * sink = GetHandle<jni::WavAudioFileSink>(env, jSink);
+	CHECK_HANDLEV(sink, 0);
+
+	audioModule->RegisterAudioCallback(sink);
+
+	return reinterpret_cast<jlong>(sink);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_removeFileSinkInternal
+(JNIEnv * env, jobject caller, jlong sinkHandle)
+{
+	webrtc::AudioDeviceModule * audioModule = GetHandle<webrtc::AudioDeviceModule>(env, caller);
+	CHECK_HANDLE(audioModule);
+
+	// The sink is owned by its Java object.
+	if (sinkHandle != 0) {
+		audioModule->RegisterAudioCallback(nullptr);
+	}
+}
+
 JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_addSourceInternal
 (JNIEnv * env, jobject caller, jobject jSource)
 {
@@ -448,6 +476,32 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_remo
 	}
 }
 
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_addFileSourceInternal
+(JNIEnv * env, jobject caller, jobject jSource)
+{
+	webrtc::AudioDeviceModule * audioModule = GetHandle<webrtc::AudioDeviceModule>(env, caller);
+	CHECK_HANDLEV(audioModule, 0);
+
+	jni::AudioSource * source = GetHandle<jni::AudioSource>(env, jSource);
+	CHECK_HANDLEV(source, 0);
+
+	audioModule->RegisterAudioCallback(source);
+
+	return reinterpret_cast<jlong>(source);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_removeFileSourceInternal
+(JNIEnv * env, jobject caller, jlong sourceHandle)
+{
+	webrtc::AudioDeviceModule * audioModule = GetHandle<webrtc::AudioDeviceModule>(env, caller);
+	CHECK_HANDLE(audioModule);
+
+	// The source is owned by its Java object.
+	if (sourceHandle != 0) {
+		audioModule->RegisterAudioCallback(nullptr);
+	}
+}
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModule_disposeInternal
 (JNIEnv * env, jobject caller)
 {
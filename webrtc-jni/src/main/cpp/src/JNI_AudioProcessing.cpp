@@ -27,7 +27,6 @@
 #include "media/audio/AudioProcessing.h"
 #include "media/audio/AudioProcessingConfig.h"
 #include "media/audio/AudioProcessingStreamConfig.h"
-#include "api/audio/audio_frame.h"
 #include "api/scoped_refptr.h"
 #include "modules/audio_processing/include/audio_processing.h"
 #include "rtc_base/logging.h"
@@ -68,51 +67,15 @@ JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_proces
 	webrtc::StreamConfig srcConfig = jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, inputConfig));
 	webrtc::StreamConfig dstConfig = jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, outputConfig));
 
-	jboolean isDstCopy = JNI_FALSE;
+	// Access the arrays without copying, no JNI calls are allowed until released.
+	jbyte * srcPtr = static_cast<jbyte *>(env->GetPrimitiveArrayCritical(src, nullptr));
+	jbyte * dstPtr = static_cast<jbyte *>(env->GetPrimitiveArrayCritical(dest, nullptr));
 
-	jbyte * srcPtr = env->GetByteArrayElements(src, NULL);
-	jbyte * dstPtr = env->GetByteArrayElements(dest, &isDstCopy);
+	int result = jni::AudioProcessing::process(apm, reinterpret_cast<const int16_t *>(srcPtr), srcConfig, dstConfig,
+		reinterpret_cast<int16_t *>(dstPtr), 1, false);
 
-	const int16_t * srcFrame = reinterpret_cast<const int16_t *>(srcPtr);
-	int16_t * dstFrame = reinterpret_cast<int16_t *>(dstPtr);
-
-	int result;
-
-	if (srcConfig.num_channels() == 1 && dstConfig.num_channels() == 2) {
-		// Up-mixing, only mono to stereo.
-		// For complex channel layouts a channel mixer is required.
-
-		const size_t srcNumSamples = srcConfig.num_samples();
-		const size_t dstNumChannels = dstConfig.num_channels();
-		const size_t frameSize = srcNumSamples * dstNumChannels;
-
-		if (frameSize > webrtc::AudioFrame::kMaxDataSizeSamples) {
-			return -9;
-		}
-
-		for (int i = static_cast<int>(srcNumSamples) - 1; i >= 0; i--) {
-			for (size_t j = 0; j < dstNumChannels; ++j) {
-				dstFrame[dstNumChannels * i + j] = srcFrame[i];
-			}
-		}
-
-		srcConfig.set_num_channels(dstNumChannels);
-
-		result = apm->ProcessStream(dstFrame, srcConfig, dstConfig, dstFrame);
-	}
-	else {
-		// Will also down-mix if required, e.g. from stereo to mono.
-		result = apm->ProcessStream(srcFrame, srcConfig, dstConfig, dstFrame);
-	}
-
-	if (isDstCopy == JNI_TRUE) {
-		jsize dstLength = env->GetArrayLength(dest);
-
-		env->SetByteArrayRegion(dest, 0, dstLength, dstPtr);
-	}
-
-	env->ReleaseByteArrayElements(src, srcPtr, JNI_ABORT);
-	env->ReleaseByteArrayElements(dest, dstPtr, JNI_ABORT);
+	env->ReleasePrimitiveArrayCritical(dest, dstPtr, 0);
+	env->ReleasePrimitiveArrayCritical(src, srcPtr, JNI_ABORT);
 
 	return result;
 }
@@ -126,53 +89,36 @@ JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_proces
 	webrtc::StreamConfig srcConfig = jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, inputConfig));
 	webrtc::StreamConfig dstConfig = jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, outputConfig));
 
-	jboolean isDstCopy = JNI_FALSE;
-
-	jbyte * srcPtr = env->GetByteArrayElements(src, nullptr);
-	jbyte * dstPtr = env->GetByteArrayElements(dest, &isDstCopy);
-
-	const int16_t * srcFrame = reinterpret_cast<const int16_t *>(srcPtr);
-	int16_t * dstFrame = reinterpret_cast<int16_t *>(dstPtr);
+	jbyte * srcPtr = static_cast<jbyte *>(env->GetPrimitiveArrayCritical(src, nullptr));
+	jbyte * dstPtr = static_cast<jbyte *>(env->GetPrimitiveArrayCritical(dest, nullptr));
 
-	int result;
+	int result = jni::AudioProcessing::process(apm, reinterpret_cast<const int16_t *>(srcPtr), srcConfig, dstConfig,
+		reinterpret_cast<int16_t *>(dstPtr), 1, true);
 
-	if (srcConfig.num_channels() == 1 && dstConfig.num_channels() == 2) {
-		// Up-mixing, only mono to stereo.
-		// For complex channel layouts a channel mixer is required.
+	env->ReleasePrimitiveArrayCritical(dest, dstPtr, 0);
+	env->ReleasePrimitiveArrayCritical(src, srcPtr, JNI_ABORT);
 
-		const size_t srcNumSamples = srcConfig.num_samples();
-		const size_t dstNumChannels = dstConfig.num_channels();
-		const size_t frameSize = srcNumSamples * dstNumChannels;
-
-		if (frameSize > webrtc::AudioFrame::kMaxDataSizeSamples) {
-			return -9;
-		}
-
-		for (int i = static_cast<int>(srcNumSamples) - 1; i >= 0; i--) {
-			for (size_t j = 0; j < dstNumChannels; ++j) {
-				dstFrame[dstNumChannels * i + j] = srcFrame[i];
-			}
-		}
-
-		srcConfig.set_num_channels(dstNumChannels);
+	return result;
+}
 
-		result = apm->ProcessReverseStream(dstFrame, srcConfig, dstConfig, dstFrame);
-	}
-	else {
-		// Will also down-mix if required, e.g. from stereo to mono.
-		result = apm->ProcessReverseStream(srcFrame, srcConfig, dstConfig, dstFrame);
-	}
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processDirect
+(JNIEnv * env, jobject caller, jobject src, jobject dest, jint srcSampleRate, jint srcChannels, jint dstSampleRate, jint dstChannels, jint frames, jboolean reverse)
+{
+	webrtc::AudioProcessing * apm = GetHandle<webrtc::AudioProcessing>(env, caller);
+	CHECK_HANDLEV(apm, 0);
 
-	if (isDstCopy == JNI_TRUE) {
-		jsize dstLength = env->GetArrayLength(dest);
+	auto srcPtr = static_cast<const int16_t *>(env->GetDirectBufferAddress(src));
+	auto dstPtr = static_cast<int16_t *>(env->GetDirectBufferAddress(dest));
 
-		env->SetByteArrayRegion(dest, 0, dstLength, dstPtr);
+	if (srcPtr == nullptr || dstPtr == nullptr) {
+		env->Throw(jni::JavaError(env, "Buffers must be direct buffers"));
+		return 0;
 	}
 
-	env->ReleaseByteArrayElements(src, srcPtr, JNI_ABORT);
-	env->ReleaseByteArrayElements(dest, dstPtr, JNI_ABORT);
+	webrtc::StreamConfig srcConfig(srcSampleRate, srcChannels);
+	webrtc::StreamConfig dstConfig(dstSampleRate, dstChannels);
 
-	return result;
+	return jni::AudioProcessing::process(apm, srcPtr, srcConfig, dstConfig, dstPtr, frames, reverse);
 }
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_dispose
@@ -212,4 +158,20 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_update
 	CHECK_HANDLE(apm);
 
 	jni::AudioProcessing::updateStats(apm->GetStatistics(), env, jni::JavaLocalRef<jobject>(env, caller));
-}
\ No newline at end of file
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_updateFrameStats
+(JNIEnv * env, jobject caller, jobject buffer)
+{
+	webrtc::AudioProcessing * apm = GetHandle<webrtc::AudioProcessing>(env, caller);
+	CHECK_HANDLE(apm);
+
+	auto data = static_cast<int32_t *>(env->GetDirectBufferAddress(buffer));
+
+	if (data == nullptr) {
+		env->Throw(jni::JavaError(env, "Buffer must be a direct buffer"));
+		return;
+	}
+
+	jni::AudioProcessing::writeFrameStats(apm->GetStatistics(), data);
+}
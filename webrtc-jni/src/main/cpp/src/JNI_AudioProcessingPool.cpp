@@ -0,0 +1,132 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_AudioProcessingPool.h"
+#include "JavaError.h"
+#include "JavaRef.h"
+#include "JavaUtils.h"
+
+#include "media/audio/AudioProcessingPool.h"
+#include "media/audio/AudioProcessingStreamConfig.h"
+
+#include <algorithm>
+#include <vector>
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_removeStream
+(JNIEnv * env, jobject caller, jint streamId)
+{
+	jni::AudioProcessingPool * pool = GetHandle<jni::AudioProcessingPool>(env, caller);
+	CHECK_HANDLE(pool);
+
+	pool->removeStream(streamId);
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_pollInternal
+(JNIEnv * env, jobject caller, jlongArray tags, jintArray streamIds, jintArray results)
+{
+	jni::AudioProcessingPool * pool = GetHandle<jni::AudioProcessingPool>(env, caller);
+	CHECK_HANDLEV(pool, 0);
+
+	jsize length = std::min({ env->GetArrayLength(tags), env->GetArrayLength(streamIds), env->GetArrayLength(results) });
+
+	std::vector<jlong> tagValues(length);
+	std::vector<jint> streamValues(length);
+	std::vector<jint> resultValues(length);
+
+	jni::AudioProcessingPool::Completion completion;
+	jsize count = 0;
+
+	while (count < length && pool->poll(completion)) {
+		tagValues[count] = completion.tag;
+		streamValues[count] = completion.streamId;
+		resultValues[count] = completion.result;
+		count++;
+	}
+
+	if (count > 0) {
+		env->SetLongArrayRegion(tags, 0, count, tagValues.data());
+		env->SetIntArrayRegion(streamIds, 0, count, streamValues.data());
+		env->SetIntArrayRegion(results, 0, count, resultValues.data());
+	}
+
+	return count;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_disposeInternal
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioProcessingPool * pool = GetHandle<jni::AudioProcessingPool>(env, caller);
+	CHECK_HANDLE(pool);
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+
+	// Stops and joins all worker threads.
+	delete pool;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_initialize
+(JNIEnv * env, jobject caller, jint threads, jint queueSize)
+{
+	try {
+		SetHandle(env, caller, new jni::AudioProcessingPool(threads, queueSize));
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_addStreamInternal
+(JNIEnv * env, jobject caller, jobject jApm, jobject inputConfig, jobject outputConfig)
+{
+	jni::AudioProcessingPool * pool = GetHandle<jni::AudioProcessingPool>(env, caller);
+	CHECK_HANDLEV(pool, -1);
+
+	webrtc::AudioProcessing * apm = GetHandle<webrtc::AudioProcessing>(env, jApm);
+	CHECK_HANDLEV(apm, -1);
+
+	webrtc::StreamConfig srcConfig = jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, inputConfig));
+	webrtc::StreamConfig dstConfig = jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, outputConfig));
+
+	// The pool holds its own reference, the stream outlives a disposed AudioProcessing.
+	return pool->addStream(rtc::scoped_refptr<webrtc::AudioProcessing>(apm), srcConfig, dstConfig);
+}
+
+JNIEXPORT jboolean JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessingPool_submitInternal
+(JNIEnv * env, jobject caller, jint streamId, jobject src, jobject dest, jint frames, jlong tag)
+{
+	jni::AudioProcessingPool * pool = GetHandle<jni::AudioProcessingPool>(env, caller);
+	CHECK_HANDLEV(pool, false);
+
+	auto srcPtr = static_cast<const int16_t *>(env->GetDirectBufferAddress(src));
+	auto dstPtr = static_cast<int16_t *>(env->GetDirectBufferAddress(dest));
+
+	if (srcPtr == nullptr || dstPtr == nullptr) {
+		env->Throw(jni::JavaError(env, "Buffers must be direct buffers"));
+		return false;
+	}
+
+	size_t srcSize = static_cast<size_t>(env->GetDirectBufferCapacity(src)) / sizeof(int16_t);
+	size_t dstSize = static_cast<size_t>(env->GetDirectBufferCapacity(dest)) / sizeof(int16_t);
+
+	try {
+		return pool->submit(streamId, srcPtr, srcSize, dstPtr, dstSize, frames, tag);
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+
+	return false;
+}
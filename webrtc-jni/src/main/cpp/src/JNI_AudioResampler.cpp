@@ -16,16 +16,17 @@
 
 #include "JNI_AudioResampler.h"
 #include "Exception.h"
+#include "JavaError.h"
 #include "JavaObject.h"
 #include "JavaRef.h"
 #include "JavaUtils.h"
 
-#include "common_audio/resampler/include/push_resampler.h"
+#include "media/audio/AudioResampler.h"
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioResampler_dispose
 (JNIEnv * env, jobject caller)
 {
-	webrtc::PushResampler<int16_t> * resampler = GetHandle<webrtc::PushResampler<int16_t>>(env, caller);
+	jni::AudioResampler * resampler = GetHandle<jni::AudioResampler>(env, caller);
 	CHECK_HANDLE(resampler);
 
 	delete resampler;
@@ -36,7 +37,7 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioResampler_dispose
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioResampler_initialize
 (JNIEnv * env, jobject caller)
 {
-	webrtc::PushResampler<int16_t> * resampler = new webrtc::PushResampler<int16_t>();
+	jni::AudioResampler * resampler = new jni::AudioResampler();
 
 	SetHandle(env, caller, resampler);
 }
@@ -44,33 +45,48 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioResampler_initial
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioResampler_resetInternal
 (JNIEnv* env, jobject caller, jint sourceRate, jint targetRate, jint channels)
 {
-	webrtc::PushResampler<int16_t> * resampler = GetHandle<webrtc::PushResampler<int16_t>>(env, caller);
+	jni::AudioResampler * resampler = GetHandle<jni::AudioResampler>(env, caller);
 	CHECK_HANDLE(resampler);
 
-	resampler->InitializeIfNeeded(sourceRate, targetRate, channels);
+	resampler->reset(sourceRate, targetRate, channels);
 }
 
 JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioResampler_resampleInternal
 (JNIEnv * env, jobject caller, jbyteArray samplesIn, jint nSamplesIn, jbyteArray samplesOut, jint maxSamplesOut)
 {
-	webrtc::PushResampler<int16_t> * resampler = GetHandle<webrtc::PushResampler<int16_t>>(env, caller);
+	jni::AudioResampler * resampler = GetHandle<jni::AudioResampler>(env, caller);
 	CHECK_HANDLEV(resampler, -1);
 
-	jboolean isDstCopy = JNI_FALSE;
+	// Access the arrays without copying, no JNI calls are allowed until released.
+	jbyte * srcPtr = static_cast<jbyte *>(env->GetPrimitiveArrayCritical(samplesIn, nullptr));
+	jbyte * dstPtr = static_cast<jbyte *>(env->GetPrimitiveArrayCritical(samplesOut, nullptr));
 
-	jbyte * srcPtr = env->GetByteArrayElements(samplesIn, nullptr);
-	jbyte * dstPtr = env->GetByteArrayElements(samplesOut, &isDstCopy);
+	int result = resampler->resample(reinterpret_cast<const int16_t *>(srcPtr), nSamplesIn,
+		reinterpret_cast<int16_t *>(dstPtr), maxSamplesOut);
 
-	size_t result = resampler->Resample(reinterpret_cast<int16_t *>(srcPtr), nSamplesIn, reinterpret_cast<int16_t *>(dstPtr), maxSamplesOut);
+	env->ReleasePrimitiveArrayCritical(samplesOut, dstPtr, 0);
+	env->ReleasePrimitiveArrayCritical(samplesIn, srcPtr, JNI_ABORT);
 
-	if (isDstCopy == JNI_TRUE) {
-		jsize dstLength = env->GetArrayLength(samplesOut);
+	return static_cast<jint>(result);
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioResampler_resampleDirect
+(JNIEnv * env, jobject caller, jobject samplesIn, jint nSamplesIn, jobject samplesOut, jint maxSamplesOut, jboolean isFloat)
+{
+	jni::AudioResampler * resampler = GetHandle<jni::AudioResampler>(env, caller);
+	CHECK_HANDLEV(resampler, -1);
+
+	void * srcPtr = env->GetDirectBufferAddress(samplesIn);
+	void * dstPtr = env->GetDirectBufferAddress(samplesOut);
 
-		env->SetByteArrayRegion(samplesOut, 0, dstLength, dstPtr);
+	if (srcPtr == nullptr || dstPtr == nullptr) {
+		env->Throw(jni::JavaError(env, "Buffers must be direct buffers"));
+		return -1;
 	}
 
-	env->ReleaseByteArrayElements(samplesIn, srcPtr, JNI_ABORT);
-	env->ReleaseByteArrayElements(samplesOut, dstPtr, JNI_ABORT);
+	if (isFloat) {
+		return resampler->resample(static_cast<const float *>(srcPtr), nSamplesIn, static_cast<float *>(dstPtr), maxSamplesOut);
+	}
 
-	return static_cast<jint>(result);
+	return resampler->resample(static_cast<const int16_t *>(srcPtr), nSamplesIn, static_cast<int16_t *>(dstPtr), maxSamplesOut);
 }
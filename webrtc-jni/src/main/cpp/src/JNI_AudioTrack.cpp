@@ -18,6 +18,7 @@
 #include "api/AudioTrackSink.h"
 #include "JavaNullPointerException.h"
 #include "JavaUtils.h"
+#include "media/audio/WavAudioFileSink.h"
 
 #include "api/media_stream_interface.h"
 
@@ -54,6 +55,34 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeSinkI
 	}
 }
 
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_addFileSinkInternal
+(JNIEnv * env, jobject caller, jobject jsink)
+{
+	webrtc::AudioTrackInterface * track = GetHandle<webrtc::AudioTrackInterface>(env, caller);
+	CHECK_HANDLEV(track, 0);
+
+	jni::WavAudioFileSink * sink = GetHandle<jni::WavAudioFileSink>(env, jsink);
+	CHECK_HANDLEV(sink, 0);
+
+	track->AddSink(sink);
+
+	return reinterpret_cast<jlong>(sink);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeFileSinkInternal
+(JNIEnv * env, jobject caller, jlong sinkHandle)
+{
+	webrtc::AudioTrackInterface * track = GetHandle<webrtc::AudioTrackInterface>(env, caller);
+	CHECK_HANDLE(track);
+
+	auto sink = reinterpret_cast<jni::WavAudioFileSink *>(sinkHandle);
+
+	// The sink is owned by its Java object.
+	if (sink != nullptr) {
+		track->RemoveSink(sink);
+	}
+}
+
 JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_getSignalLevel
 (JNIEnv * env, jobject caller)
 {
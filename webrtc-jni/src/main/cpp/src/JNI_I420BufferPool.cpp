@@ -0,0 +1,36 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_I420BufferPool.h"
+#include "media/video/I420BufferPool.h"
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_I420BufferPool_setMaxBuffersInternal
+(JNIEnv * env, jclass, jint maxBuffers)
+{
+	jni::I420BufferPool::shared().setMaxBuffers(static_cast<size_t>(maxBuffers));
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_video_I420BufferPool_getMaxBuffers
+(JNIEnv * env, jclass)
+{
+	return static_cast<jint>(jni::I420BufferPool::shared().getMaxBuffers());
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_I420BufferPool_release
+(JNIEnv * env, jclass)
+{
+	jni::I420BufferPool::shared().release();
+}
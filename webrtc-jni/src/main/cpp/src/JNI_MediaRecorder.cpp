@@ -0,0 +1,103 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_MediaRecorder.h"
+#include "JavaNullPointerException.h"
+#include "JavaRef.h"
+#include "JavaString.h"
+#include "JavaUtils.h"
+
+#include "media/MediaRecorder.h"
+
+#include "api/rtp_receiver_interface.h"
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_stop
+(JNIEnv * env, jobject caller)
+{
+	jni::MediaRecorder * recorder = GetHandle<jni::MediaRecorder>(env, caller);
+	CHECK_HANDLE(recorder);
+
+	recorder->stop();
+}
+
+JNIEXPORT jboolean JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_isRecording
+(JNIEnv * env, jobject caller)
+{
+	jni::MediaRecorder * recorder = GetHandle<jni::MediaRecorder>(env, caller);
+	CHECK_HANDLEV(recorder, false);
+
+	return static_cast<jboolean>(recorder->isRecording());
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_getPayloadType
+(JNIEnv * env, jobject caller)
+{
+	jni::MediaRecorder * recorder = GetHandle<jni::MediaRecorder>(env, caller);
+	CHECK_HANDLEV(recorder, -1);
+
+	return static_cast<jint>(recorder->getPayloadType());
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::MediaRecorder * recorder = GetHandle<jni::MediaRecorder>(env, caller);
+	CHECK_HANDLE(recorder);
+
+	recorder->stop();
+
+	// The receiver keeps its reference, the recorder remains as a pass-through transformer.
+	recorder->Release();
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+
+	recorder = nullptr;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_initialize
+(JNIEnv * env, jobject caller, jobject jReceiver)
+{
+	if (jReceiver == nullptr) {
+		env->Throw(jni::JavaNullPointerException(env, "RTCRtpReceiver must not be null"));
+		return;
+	}
+
+	webrtc::RtpReceiverInterface * receiver = GetHandle<webrtc::RtpReceiverInterface>(env, jReceiver);
+	CHECK_HANDLE(receiver);
+
+	rtc::scoped_refptr<jni::MediaRecorder> recorder = new rtc::RefCountedObject<jni::MediaRecorder>(receiver->media_type());
+
+	receiver->SetDepacketizerToDecoderFrameTransformer(recorder);
+
+	SetHandle(env, caller, recorder.release());
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_MediaRecorder_startInternal
+(JNIEnv * env, jobject caller, jstring jFileName, jstring jCodecName, jint channels, jint payloadType)
+{
+	jni::MediaRecorder * recorder = GetHandle<jni::MediaRecorder>(env, caller);
+	CHECK_HANDLE(recorder);
+
+	std::string fileName = jni::JavaString::toNative(env, jni::JavaLocalRef<jstring>(env, jFileName));
+	std::string codecName = jni::JavaString::toNative(env, jni::JavaLocalRef<jstring>(env, jCodecName));
+
+	try {
+		recorder->start(fileName, codecName, channels, payloadType);
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+}
@@ -16,6 +16,7 @@
 
 #include "JNI_NativeI420Buffer.h"
 #include "api/VideoFrame.h"
+#include "media/video/I420BufferPool.h"
 #include "JavaRuntimeException.h"
 
 #include "api/video/i420_buffer.h"
@@ -24,12 +25,10 @@
 JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_media_video_NativeI420Buffer_allocate
 (JNIEnv * env, jclass caller, jint width, jint height)
 {
-	rtc::scoped_refptr<webrtc::I420BufferInterface> i420Buffer = webrtc::I420Buffer::Create(width, height);
+	rtc::scoped_refptr<webrtc::I420BufferInterface> i420Buffer = jni::I420BufferPool::shared().create(width, height);
 
 	jni::JavaLocalRef<jobject> jBuffer = jni::I420Buffer::toJava(env, i420Buffer);
 
-	i420Buffer->AddRef();
-
 	return jBuffer.release();
 }
 
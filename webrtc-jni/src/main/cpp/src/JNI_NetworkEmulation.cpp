@@ -0,0 +1,126 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "JNI_NetworkEmulation.h"
+#include "rtc/EmulatedNetwork.h"
+#include "rtc/NetworkEmulation.h"
+#include "Exception.h"
+#include "JavaFactories.h"
+#include "JavaNullPointerException.h"
+#include "JavaRef.h"
+#include "JavaUtils.h"
+
+JNIEXPORT jboolean JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_isSupported
+(JNIEnv * env, jclass caller)
+{
+#if defined(WEBRTC_NETWORK_EMULATION)
+	return JNI_TRUE;
+#else
+	return JNI_FALSE;
+#endif
+}
+
+#if defined(WEBRTC_NETWORK_EMULATION)
+
+static bool CheckLinkParams(JNIEnv * env, jobject jFrom, jobject jTo, jobject jConfig)
+{
+	if (jFrom == nullptr || jTo == nullptr) {
+		env->Throw(jni::JavaNullPointerException(env, "EmulatedNetwork is null"));
+		return false;
+	}
+	if (jConfig == nullptr) {
+		env->Throw(jni::JavaNullPointerException(env, "NetworkEmulationConfig is null"));
+		return false;
+	}
+
+	return true;
+}
+
+JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_createNetwork
+(JNIEnv * env, jobject caller)
+{
+	jni::NetworkEmulation * emulation = GetHandle<jni::NetworkEmulation>(env, caller);
+	CHECK_HANDLEV(emulation, nullptr);
+
+	jni::EmulatedNetwork * network = emulation->createNetwork();
+
+	return jni::JavaFactories::create(env, network).release();
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_createLink
+(JNIEnv * env, jobject caller, jobject jFrom, jobject jTo, jobject jConfig)
+{
+	jni::NetworkEmulation * emulation = GetHandle<jni::NetworkEmulation>(env, caller);
+	CHECK_HANDLE(emulation);
+
+	if (!CheckLinkParams(env, jFrom, jTo, jConfig)) {
+		return;
+	}
+
+	try {
+		emulation->createLink(GetHandle<jni::EmulatedNetwork>(env, jFrom), GetHandle<jni::EmulatedNetwork>(env, jTo),
+			jni::NetworkEmulationConfig::toNative(env, jni::JavaLocalRef<jobject>(env, jConfig)));
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_updateLink
+(JNIEnv * env, jobject caller, jobject jFrom, jobject jTo, jobject jConfig)
+{
+	jni::NetworkEmulation * emulation = GetHandle<jni::NetworkEmulation>(env, caller);
+	CHECK_HANDLE(emulation);
+
+	if (!CheckLinkParams(env, jFrom, jTo, jConfig)) {
+		return;
+	}
+
+	try {
+		emulation->updateLink(GetHandle<jni::EmulatedNetwork>(env, jFrom), GetHandle<jni::EmulatedNetwork>(env, jTo),
+			jni::NetworkEmulationConfig::toNative(env, jni::JavaLocalRef<jobject>(env, jConfig)));
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::NetworkEmulation * emulation = GetHandle<jni::NetworkEmulation>(env, caller);
+	CHECK_HANDLE(emulation);
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+
+	delete emulation;
+}
+
+#endif
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_NetworkEmulation_initialize
+(JNIEnv * env, jobject caller)
+{
+	try {
+#if defined(WEBRTC_NETWORK_EMULATION)
+		SetHandle(env, caller, new jni::NetworkEmulation());
+#else
+		throw jni::Exception("Network emulation is not supported by this build");
+#endif
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+}
@@ -20,6 +20,8 @@
 #include "api/PeerConnectionObserver.h"
 #include "api/RTCConfiguration.h"
 #include "api/RTCRtpCapabilities.h"
+#include "rtc/Diagnostics.h"
+#include "rtc/EmulatedNetwork.h"
 #include "JavaEnums.h"
 #include "JavaError.h"
 #include "JavaFactories.h"
@@ -36,18 +38,23 @@
 #include "api/video_codecs/builtin_video_encoder_factory.h"
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_PeerConnectionFactory_initialize
-(JNIEnv * env, jobject caller, jobject audioModule, jobject audioProcessing)
+(JNIEnv * env, jobject caller, jobject audioModule, jobject audioProcessing, jobject jNetwork)
 {
 	webrtc::AudioDeviceModule * audioDevModule = (audioModule != nullptr)
 		? GetHandle<webrtc::AudioDeviceModule>(env, audioModule)
 		: nullptr;
 
+	jni::EmulatedNetwork * network = (jNetwork != nullptr)
+		? GetHandle<jni::EmulatedNetwork>(env, jNetwork)
+		: nullptr;
+
 	try {
-		auto networkThread = rtc::Thread::CreateWithSocketServer();
+		// The thread of an emulated network is owned by the emulation.
+		std::unique_ptr<rtc::Thread> networkThread = network ? nullptr : rtc::Thread::CreateWithSocketServer();
 		auto signalingThread = rtc::Thread::Create();
 		auto workerThread = rtc::Thread::Create();
 
-		if (!networkThread->Start()) {
+		if (networkThread && !networkThread->Start()) {
 			throw jni::Exception("Start network thread failed");
 		}
 		if (!signalingThread->Start()) {
@@ -63,7 +70,7 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_PeerConnectionFactory_initialize
 		rtc::scoped_refptr<webrtc::AudioProcessing> apm(processing);
 
 		auto factory = webrtc::CreatePeerConnectionFactory(
-			networkThread.get(),
+			network ? network->getNetworkThread() : networkThread.get(),
 			workerThread.get(),
 			signalingThread.get(),
 			audioDevModule,
@@ -77,6 +84,7 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_PeerConnectionFactory_initialize
 		if (factory != nullptr) {
 			SetHandle(env, caller, factory.release());
 			SetHandle(env, caller, "networkThreadHandle", networkThread.release());
+			SetHandle(env, caller, "networkHandle", network);
 			SetHandle(env, caller, "signalingThreadHandle", signalingThread.release());
 			SetHandle(env, caller, "workerThreadHandle", workerThread.release());
 		}
@@ -220,9 +228,17 @@ JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_PeerConnectionFactory_createPee
 	webrtc::PeerConnectionObserver * observer = new jni::PeerConnectionObserver(env, jni::JavaGlobalRef<jobject>(env, jobserver));
 	webrtc::PeerConnectionDependencies dependencies(observer);
 
+	jni::EmulatedNetwork * network = GetHandle<jni::EmulatedNetwork>(env, caller, "networkHandle");
+
+	if (network) {
+		dependencies.allocator = network->createPortAllocator();
+	}
+
 	auto result = factory->CreatePeerConnectionOrError(configuration, std::move(dependencies));
 
 	if (!result.ok()) {
+		delete observer;
+
 		env->Throw(jni::JavaRuntimeException(env, "Create PeerConnection failed: %s %s",
 			ToString(result.error().type()), result.error().message()));
 
@@ -236,9 +252,13 @@ JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_PeerConnectionFactory_createPee
 
 		SetHandle(env, javaPeerConnection.get(), "observerHandle", observer);
 
+		jni::Diagnostics::increment(jni::Diagnostics::Counter::kPeerConnections);
+
 		return javaPeerConnection.release();
 	}
 
+	delete observer;
+
 	return nullptr;
 }
 
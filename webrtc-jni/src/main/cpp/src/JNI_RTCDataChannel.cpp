@@ -26,13 +26,31 @@
 
 #include <memory>
 
+static void DeleteObserver(JNIEnv * env, jobject caller)
+{
+	auto observer = GetHandle<jni::RTCDataChannelObserver>(env, caller, "observerHandle");
+
+	if (observer) {
+		SetHandle<std::nullptr_t>(env, caller, "observerHandle", nullptr);
+
+		delete observer;
+	}
+}
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_registerObserver
 (JNIEnv * env, jobject caller, jobject jObserver)
 {
 	webrtc::DataChannelInterface * channel = GetHandle<webrtc::DataChannelInterface>(env, caller);
 	CHECK_HANDLE(channel);
 
-	channel->RegisterObserver(new jni::RTCDataChannelObserver(env, jni::JavaGlobalRef<jobject>(env, jObserver)));
+	auto observer = new jni::RTCDataChannelObserver(env, jni::JavaGlobalRef<jobject>(env, jObserver));
+
+	// Replaces the previous observer, which then receives no more events.
+	channel->RegisterObserver(observer);
+
+	DeleteObserver(env, caller);
+
+	SetHandle(env, caller, "observerHandle", observer);
 }
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_unregisterObserver
@@ -42,6 +60,8 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_unregisterObserver
 	CHECK_HANDLE(channel);
 
 	channel->UnregisterObserver();
+
+	DeleteObserver(env, caller);
 }
 
 JNIEXPORT jstring JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_getLabel
@@ -149,6 +169,12 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_dispose
 	webrtc::DataChannelInterface * channel = GetHandle<webrtc::DataChannelInterface>(env, caller);
 	CHECK_HANDLE(channel);
 
+	if (GetHandle<jni::RTCDataChannelObserver>(env, caller, "observerHandle")) {
+		channel->UnregisterObserver();
+
+		DeleteObserver(env, caller);
+	}
+
 	rtc::RefCountReleaseStatus status = channel->Release();
 
 	if (status != rtc::RefCountReleaseStatus::kDroppedLastRef) {
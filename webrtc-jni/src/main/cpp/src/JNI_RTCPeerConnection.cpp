@@ -16,6 +16,7 @@
 
 #include "JNI_RTCPeerConnection.h"
 #include "api/CreateSessionDescriptionObserver.h"
+#include "api/RTCBandwidthEstimationObserver.h"
 #include "api/SetSessionDescriptionObserver.h"
 #include "api/RTCAnswerOptions.h"
 #include "api/RTCConfiguration.h"
@@ -26,6 +27,7 @@
 #include "api/RTCSessionDescription.h"
 #include "api/RTCStatsCollectorCallback.h"
 #include "api/WebRTCUtils.h"
+#include "rtc/Diagnostics.h"
 #include "JavaArray.h"
 #include "JavaEnums.h"
 #include "JavaError.h"
@@ -33,6 +35,7 @@
 #include "JavaIterable.h"
 #include "JavaList.h"
 #include "JavaNullPointerException.h"
+#include "JavaPrimitive.h"
 #include "JavaRef.h"
 #include "JavaRuntimeException.h"
 #include "JavaString.h"
@@ -582,6 +585,67 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getStats__Ldev_o
 	pc->GetStats(sender, callback);
 }
 
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_setBitrate
+(JNIEnv * env, jobject caller, jobject jMinBitrate, jobject jStartBitrate, jobject jMaxBitrate)
+{
+	webrtc::PeerConnectionInterface * pc = GetHandle<webrtc::PeerConnectionInterface>(env, caller);
+	CHECK_HANDLE(pc);
+
+	webrtc::BitrateSettings settings;
+
+	if (jMinBitrate) {
+		settings.min_bitrate_bps = jni::Integer::getValue(env, jMinBitrate);
+	}
+	if (jStartBitrate) {
+		settings.start_bitrate_bps = jni::Integer::getValue(env, jStartBitrate);
+	}
+	if (jMaxBitrate) {
+		settings.max_bitrate_bps = jni::Integer::getValue(env, jMaxBitrate);
+	}
+
+	webrtc::RTCError error = pc->SetBitrate(settings);
+
+	if (!error.ok()) {
+		env->Throw(jni::JavaRuntimeException(env, jni::RTCErrorToString(error).c_str()));
+	}
+}
+
+static void StopBandwidthEstimationObserver(JNIEnv * env, jobject caller)
+{
+	auto observer = GetHandle<jni::RTCBandwidthEstimationObserver>(env, caller, "bweObserverHandle");
+
+	if (observer) {
+		observer->stop();
+		observer->Release();
+
+		SetHandle<std::nullptr_t>(env, caller, "bweObserverHandle", nullptr);
+	}
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_setBandwidthEstimationObserver
+(JNIEnv * env, jobject caller, jobject jObserver, jint intervalMs)
+{
+	webrtc::PeerConnectionInterface * pc = GetHandle<webrtc::PeerConnectionInterface>(env, caller);
+	CHECK_HANDLE(pc);
+
+	StopBandwidthEstimationObserver(env, caller);
+
+	if (jObserver == nullptr) {
+		return;
+	}
+	if (intervalMs <= 0) {
+		env->Throw(jni::JavaRuntimeException(env, "Interval must be positive"));
+		return;
+	}
+
+	rtc::scoped_refptr<jni::RTCBandwidthEstimationObserver> observer = new rtc::RefCountedObject<jni::RTCBandwidthEstimationObserver>(
+		env, jni::JavaGlobalRef<jobject>(env, jObserver), pc, static_cast<int>(intervalMs));
+
+	observer->start();
+
+	SetHandle(env, caller, "bweObserverHandle", observer.release());
+}
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_restartIce
 (JNIEnv * env, jobject caller)
 {
@@ -598,6 +662,8 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_close
 	CHECK_HANDLE(pc);
 
 	try {
+		StopBandwidthEstimationObserver(env, caller);
+
 		pc->Close();
 
 		SetHandle<std::nullptr_t>(env, caller, nullptr);
@@ -607,6 +673,8 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_close
 		if (observer) {
 			delete observer;
 		}
+
+		jni::Diagnostics::decrement(jni::Diagnostics::Counter::kPeerConnections);
 	}
 	catch (...) {
 		ThrowCxxJavaException(env);
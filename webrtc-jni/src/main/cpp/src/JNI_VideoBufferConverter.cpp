@@ -16,10 +16,20 @@
 
 #include "JNI_VideoBufferConverter.h"
 #include "JavaRuntimeException.h"
+#include "media/ThreadPool.h"
 
 #include "libyuv/convert_from.h"
+#include "libyuv/scale.h"
 #include "libyuv/video_common.h"
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+// Frames from this size on (about 4K) are converted in row bands on multiple threads.
+static const int64_t kParallelMinPixels = 3840 * 2160 / 2;
+static const size_t kMaxBands = 8;
+
 size_t CalcBufferSize(int width, int height, int fourCC) {
 	size_t bufferSize = 0;
 
@@ -58,6 +68,69 @@ size_t CalcBufferSize(int width, int height, int fourCC) {
 	return bufferSize;
 }
 
+static int PackedBytesPerPixel(int fourCC) {
+	switch (fourCC) {
+		case libyuv::FOURCC_R444:
+		case libyuv::FOURCC_RGBP:
+		case libyuv::FOURCC_RGBO:
+		case libyuv::FOURCC_YUY2:
+		case libyuv::FOURCC_UYVY:
+			return 2;
+
+		case libyuv::FOURCC_24BG:
+			return 3;
+
+		case libyuv::FOURCC_ARGB:
+		case libyuv::FOURCC_ABGR:
+		case libyuv::FOURCC_BGRA:
+		case libyuv::FOURCC_RGBA:
+			return 4;
+
+		default:
+			// Planar formats are not split into bands.
+			return 0;
+	}
+}
+
+static int ConvertFromI420(const uint8_t * srcY, int srcStrideY, const uint8_t * srcU, int srcStrideU,
+	const uint8_t * srcV, int srcStrideV, uint8_t * dst, int width, int height, int fourCC)
+{
+	const int bytesPerPixel = PackedBytesPerPixel(fourCC);
+
+	jni::ThreadPool & pool = jni::ThreadPool::shared();
+
+	if (bytesPerPixel == 0 || static_cast<int64_t>(width) * height < kParallelMinPixels || pool.size() == 0) {
+		return libyuv::ConvertFromI420(srcY, srcStrideY, srcU, srcStrideU, srcV, srcStrideV,
+			dst, 0, width, height, static_cast<uint32_t>(fourCC));
+	}
+
+	const size_t bands = std::min(pool.size() + 1, kMaxBands);
+	const size_t dstStride = static_cast<size_t>(width) * bytesPerPixel;
+
+	// Even band heights keep the chroma rows aligned with the luma rows.
+	const int bandHeight = ((height + static_cast<int>(bands) - 1) / static_cast<int>(bands) + 1) & ~1;
+
+	std::atomic<int> result(0);
+
+	pool.parallelFor(bands, [&](size_t band) {
+		const int y = static_cast<int>(band) * bandHeight;
+
+		if (y >= height) {
+			return;
+		}
+
+		int ret = libyuv::ConvertFromI420(srcY + y * srcStrideY, srcStrideY,
+			srcU + y / 2 * srcStrideU, srcStrideU, srcV + y / 2 * srcStrideV, srcStrideV,
+			dst + y * dstStride, 0, width, std::min(bandHeight, height - y), static_cast<uint32_t>(fourCC));
+
+		if (ret != 0) {
+			result = ret;
+		}
+	});
+
+	return result;
+}
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoBufferConverter_I420toByteArray
 (JNIEnv * env, jclass cls, jobject jSrcY, jint srcStrideY, jobject jSrcU, jint srcStrideU,
 	jobject jSrcV, jint srcStrideV, jbyteArray dst, jint width, jint height, jint fourCC)
@@ -75,14 +148,13 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoBufferConverter_I
 	const uint8_t * srcU = static_cast<uint8_t *>(env->GetDirectBufferAddress(jSrcU));
 	const uint8_t * srcV = static_cast<uint8_t *>(env->GetDirectBufferAddress(jSrcV));
 
-	jbyte * arrayPtr = env->GetByteArrayElements(dst, nullptr);
-	uint8_t * dstPtr = reinterpret_cast<uint8_t *>(arrayPtr);
+	// Write directly into the array, no JNI calls are allowed until released.
+	uint8_t * dstPtr = static_cast<uint8_t *>(env->GetPrimitiveArrayCritical(dst, nullptr));
 
-	libyuv::ConvertFromI420(srcY, srcStrideY, srcU, srcStrideU, srcV, srcStrideV,
-		dstPtr, 0, width, height, static_cast<uint32_t>(fourCC));
+	ConvertFromI420(srcY, srcStrideY, srcU, srcStrideU, srcV, srcStrideV,
+		dstPtr, width, height, fourCC);
 
-	env->SetByteArrayRegion(dst, 0, arrayLength, arrayPtr);
-	env->ReleaseByteArrayElements(dst, arrayPtr, JNI_ABORT);
+	env->ReleasePrimitiveArrayCritical(dst, dstPtr, 0);
 }
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoBufferConverter_I420toDirectBuffer
@@ -105,10 +177,118 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoBufferConverter_I
 			return;
 		}
 
-		libyuv::ConvertFromI420(srcY, srcStrideY, srcU, srcStrideU, srcV, srcStrideV,
-			address, 0, width, height, static_cast<uint32_t>(fourCC));
+		ConvertFromI420(srcY, srcStrideY, srcU, srcStrideU, srcV, srcStrideV,
+			address, width, height, fourCC);
 	}
 	else {
 		env->Throw(jni::JavaRuntimeException(env, "Non-direct buffer provided"));
 	}
-}
\ No newline at end of file
+}
+
+static int ConvertScaled(const uint8_t * srcY, int srcStrideY, const uint8_t * srcU, int srcStrideU,
+	const uint8_t * srcV, int srcStrideV, int cropX, int cropY, int cropWidth, int cropHeight,
+	uint8_t * dst, int dstWidth, int dstHeight, int fourCC)
+{
+	// Chroma planes are subsampled. Odd origins are rejected by the Java API, never shift the chroma.
+	cropX &= ~1;
+	cropY &= ~1;
+
+	srcY += cropX + cropY * srcStrideY;
+	srcU += cropX / 2 + cropY / 2 * srcStrideU;
+	srcV += cropX / 2 + cropY / 2 * srcStrideV;
+
+	if (cropWidth == dstWidth && cropHeight == dstHeight) {
+		return ConvertFromI420(srcY, srcStrideY, srcU, srcStrideU, srcV, srcStrideV,
+			dst, dstWidth, dstHeight, fourCC);
+	}
+
+	// Only the scaled frame is buffered, reused across calls on the same thread.
+	thread_local std::vector<uint8_t> scratch;
+
+	const int chromaWidth = (dstWidth + 1) / 2;
+	const int chromaHeight = (dstHeight + 1) / 2;
+	const size_t sizeY = static_cast<size_t>(dstWidth) * dstHeight;
+	const size_t sizeUV = static_cast<size_t>(chromaWidth) * chromaHeight;
+
+	if (scratch.size() < sizeY + sizeUV * 2) {
+		scratch.resize(sizeY + sizeUV * 2);
+	}
+
+	uint8_t * scaledY = scratch.data();
+	uint8_t * scaledU = scaledY + sizeY;
+	uint8_t * scaledV = scaledU + sizeUV;
+
+	int result = libyuv::I420Scale(srcY, srcStrideY, srcU, srcStrideU, srcV, srcStrideV, cropWidth, cropHeight,
+		scaledY, dstWidth, scaledU, chromaWidth, scaledV, chromaWidth, dstWidth, dstHeight, libyuv::kFilterBox);
+
+	if (result != 0) {
+		return result;
+	}
+
+	return ConvertFromI420(scaledY, dstWidth, scaledU, chromaWidth, scaledV, chromaWidth,
+		dst, dstWidth, dstHeight, fourCC);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoBufferConverter_I420toByteArrayScaled
+(JNIEnv * env, jclass, jobject jSrcY, jint srcStrideY, jobject jSrcU, jint srcStrideU,
+	jobject jSrcV, jint srcStrideV, jint cropX, jint cropY, jint cropWidth, jint cropHeight,
+	jbyteArray dst, jint dstWidth, jint dstHeight, jint fourCC)
+{
+	jsize arrayLength = env->GetArrayLength(dst);
+	size_t requiredSize = CalcBufferSize(dstWidth, dstHeight, fourCC);
+
+	if (arrayLength < requiredSize) {
+		env->Throw(jni::JavaRuntimeException(env, "Insufficient buffer size [has %d, need %zd]",
+			arrayLength, requiredSize));
+		return;
+	}
+
+	const uint8_t * srcY = static_cast<uint8_t *>(env->GetDirectBufferAddress(jSrcY));
+	const uint8_t * srcU = static_cast<uint8_t *>(env->GetDirectBufferAddress(jSrcU));
+	const uint8_t * srcV = static_cast<uint8_t *>(env->GetDirectBufferAddress(jSrcV));
+
+	// Write directly into the array, no JNI calls are allowed until released.
+	uint8_t * dstPtr = static_cast<uint8_t *>(env->GetPrimitiveArrayCritical(dst, nullptr));
+
+	int result = ConvertScaled(srcY, srcStrideY, srcU, srcStrideU, srcV, srcStrideV,
+		cropX, cropY, cropWidth, cropHeight, dstPtr, dstWidth, dstHeight, fourCC);
+
+	env->ReleasePrimitiveArrayCritical(dst, dstPtr, 0);
+
+	if (result != 0) {
+		env->Throw(jni::JavaRuntimeException(env, "Scaled conversion from I420 failed"));
+	}
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoBufferConverter_I420toDirectBufferScaled
+(JNIEnv * env, jclass, jobject jSrcY, jint srcStrideY, jobject jSrcU, jint srcStrideU,
+	jobject jSrcV, jint srcStrideV, jint cropX, jint cropY, jint cropWidth, jint cropHeight,
+	jobject dst, jint dstWidth, jint dstHeight, jint fourCC)
+{
+	const uint8_t * srcY = static_cast<uint8_t *>(env->GetDirectBufferAddress(jSrcY));
+	const uint8_t * srcU = static_cast<uint8_t *>(env->GetDirectBufferAddress(jSrcU));
+	const uint8_t * srcV = static_cast<uint8_t *>(env->GetDirectBufferAddress(jSrcV));
+
+	uint8_t * address = static_cast<uint8_t *>(env->GetDirectBufferAddress(dst));
+
+	if (address == NULL) {
+		env->Throw(jni::JavaRuntimeException(env, "Non-direct buffer provided"));
+		return;
+	}
+
+	size_t bufferLength = env->GetDirectBufferCapacity(dst);
+	size_t requiredSize = CalcBufferSize(dstWidth, dstHeight, fourCC);
+
+	if (bufferLength < requiredSize) {
+		env->Throw(jni::JavaRuntimeException(env, "Insufficient buffer size [has %zd, need %zd]",
+			bufferLength, requiredSize));
+		return;
+	}
+
+	int result = ConvertScaled(srcY, srcStrideY, srcU, srcStrideU, srcV, srcStrideV,
+		cropX, cropY, cropWidth, cropHeight, address, dstWidth, dstHeight, fourCC);
+
+	if (result != 0) {
+		env->Throw(jni::JavaRuntimeException(env, "Scaled conversion from I420 failed"));
+	}
+}
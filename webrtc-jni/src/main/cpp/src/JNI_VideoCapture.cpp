@@ -17,7 +17,9 @@
 #include "JNI_VideoCapture.h"
 #include "api/VideoTrackSink.h"
 #include "media/video/VideoCapture.h"
+#include "media/video/VideoCaptureCapability.h"
 #include "media/video/VideoDevice.h"
+#include "media/video/VideoFrameRing.h"
 #include "JavaRef.h"
 #include "JavaObject.h"
 #include "JavaString.h"
@@ -50,14 +52,7 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoCapture_setVideoC
 		return;
 	}
 
-	jint width = env->GetIntField(jcapability, GetFieldID(env, jcapability, "width", "I"));
-	jint height = env->GetIntField(jcapability, GetFieldID(env, jcapability, "height", "I"));
-	jint frameRate = env->GetIntField(jcapability, GetFieldID(env, jcapability, "frameRate", "I"));
-
-	webrtc::VideoCaptureCapability capability;
-	capability.width = static_cast<int32_t>(width);
-	capability.height = static_cast<int32_t>(height);
-	capability.maxFPS = static_cast<int32_t>(frameRate);
+	webrtc::VideoCaptureCapability capability = jni::VideoCaptureCapability::toNative(env, jni::JavaLocalRef<jobject>(env, jcapability));
 
 	videoSource->setVideoCaptureCapability(capability);
 }
@@ -76,6 +71,23 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoCapture_setVideoS
 	videoSource->setVideoSink(std::make_unique<jni::VideoTrackSink>(env, jni::JavaGlobalRef<jobject>(env, jsink)));
 }
 
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoCapture_setVideoFrameRing
+(JNIEnv * env, jobject caller, jobject jring)
+{
+	if (jring == nullptr) {
+		env->Throw(jni::JavaNullPointerException(env, "VideoFrameRing must not be null"));
+		return;
+	}
+
+	jni::VideoCapture * videoSource = GetHandle<jni::VideoCapture>(env, caller);
+	CHECK_HANDLE(videoSource);
+
+	jni::VideoFrameRing * ring = GetHandle<jni::VideoFrameRing>(env, jring);
+	CHECK_HANDLE(ring);
+
+	videoSource->setVideoSink(std::make_unique<jni::VideoFrameRingSink>(ring));
+}
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoCapture_start
 (JNIEnv * env, jobject caller)
 {
@@ -112,7 +124,8 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoCapture_dispose
 
 	SetHandle<std::nullptr_t>(env, caller, nullptr);
 
-	videoSource = nullptr;
+	// Stops capturing and frees the sink.
+	delete videoSource;
 }
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoCapture_initialize
@@ -16,14 +16,21 @@
 
 #include "JNI_VideoDesktopSource.h"
 #include "api/VideoTrackSink.h"
+#include "media/video/VideoDesktopSourceStats.h"
 #include "media/video/VideoTrackDesktopSource.h"
+#include "JavaError.h"
 #include "JavaRef.h"
 #include "JavaObject.h"
+#include "JavaRuntimeException.h"
 #include "JavaString.h"
 #include "JavaUtils.h"
+#include "modules/desktop_capture/desktop_frame.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/ref_counted_object.h"
 
+#include <memory>
+#include <vector>
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_setSourceId
 (JNIEnv * env, jobject caller, jlong sourceId, jboolean isWindow)
 {
@@ -60,6 +67,15 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_set
 	videoSource->setFocusSelectedSource(focus);
 }
 
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_setConversionStripes
+(JNIEnv * env, jobject caller, jint stripes)
+{
+	jni::VideoTrackDesktopSource * videoSource = GetHandle<jni::VideoTrackDesktopSource>(env, caller);
+	CHECK_HANDLE(videoSource);
+
+	videoSource->setConversionStripes(static_cast<int>(stripes));
+}
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_start
 (JNIEnv * env, jobject caller)
 {
@@ -88,6 +104,59 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_sto
 	}
 }
 
+JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_getStats
+(JNIEnv * env, jobject caller)
+{
+	jni::VideoTrackDesktopSource * videoSource = GetHandle<jni::VideoTrackDesktopSource>(env, caller);
+	CHECK_HANDLEV(videoSource, nullptr);
+
+	return jni::VideoDesktopSourceStats::toJava(env, videoSource->getStats()).release();
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_processFrame
+(JNIEnv * env, jobject caller, jobject buffer, jint width, jint height, jintArray updatedRects, jboolean drop)
+{
+	jni::VideoTrackDesktopSource * videoSource = GetHandle<jni::VideoTrackDesktopSource>(env, caller);
+	CHECK_HANDLE(videoSource);
+
+	auto data = static_cast<const uint8_t *>(env->GetDirectBufferAddress(buffer));
+
+	if (data == nullptr) {
+		env->Throw(jni::JavaError(env, "Buffer must be a direct buffer"));
+		return;
+	}
+	if (width <= 0 || height <= 0) {
+		env->Throw(jni::JavaRuntimeException(env, "Invalid frame size [%dx%d]", width, height));
+		return;
+	}
+
+	const jlong capacity = env->GetDirectBufferCapacity(buffer);
+	const jlong required = static_cast<jlong>(width) * height * webrtc::DesktopFrame::kBytesPerPixel;
+
+	if (capacity < required) {
+		env->Throw(jni::JavaRuntimeException(env, "Insufficient buffer size [has %lld, need %lld]",
+			static_cast<long long>(capacity), static_cast<long long>(required)));
+		return;
+	}
+
+	auto frame = std::make_unique<webrtc::BasicDesktopFrame>(webrtc::DesktopSize(width, height));
+	frame->CopyPixelsFrom(data, width * webrtc::DesktopFrame::kBytesPerPixel, webrtc::DesktopRect::MakeWH(width, height));
+
+	// Rectangles are packed as x, y, width and height.
+	jsize length = env->GetArrayLength(updatedRects);
+	std::vector<jint> rects(length);
+
+	env->GetIntArrayRegion(updatedRects, 0, length, rects.data());
+
+	for (jsize i = 0; i + 3 < length; i += 4) {
+		frame->mutable_updated_region()->AddRect(webrtc::DesktopRect::MakeXYWH(rects[i], rects[i + 1], rects[i + 2], rects[i + 3]));
+	}
+
+	if (!videoSource->processFrame(std::move(frame), static_cast<bool>(drop))) {
+		env->Throw(jni::JavaRuntimeException(env, "Cannot process frames while capturing"));
+	}
+}
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDesktopSource_dispose
 (JNIEnv * env, jobject caller)
 {
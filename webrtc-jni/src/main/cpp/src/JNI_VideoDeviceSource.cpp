@@ -16,6 +16,7 @@
 
 #include "JNI_VideoDeviceSource.h"
 #include "api/VideoTrackSink.h"
+#include "media/video/VideoCaptureCapability.h"
 #include "media/video/VideoDevice.h"
 #include "media/video/VideoTrackDeviceSource.h"
 #include "JavaRef.h"
@@ -50,14 +51,7 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoDeviceSource_setV
 		return;
 	}
 
-	jint width = env->GetIntField(jcapability, GetFieldID(env, jcapability, "width", "I"));
-	jint height = env->GetIntField(jcapability, GetFieldID(env, jcapability, "height", "I"));
-	jint frameRate = env->GetIntField(jcapability, GetFieldID(env, jcapability, "frameRate", "I"));
-
-	webrtc::VideoCaptureCapability capability;
-	capability.width = static_cast<int32_t>(width);
-	capability.height = static_cast<int32_t>(height);
-	capability.maxFPS = static_cast<int32_t>(frameRate);
+	webrtc::VideoCaptureCapability capability = jni::VideoCaptureCapability::toNative(env, jni::JavaLocalRef<jobject>(env, jcapability));
 
 	videoSource->setVideoCaptureCapability(capability);
 }
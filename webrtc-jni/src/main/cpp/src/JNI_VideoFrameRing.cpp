@@ -0,0 +1,60 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "JNI_VideoFrameRing.h"
+#include "media/video/VideoFrameRing.h"
+#include "JavaEnums.h"
+#include "JavaRef.h"
+#include "JavaUtils.h"
+
+#include "rtc_base/ref_counted_object.h"
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_video_VideoFrameRing_getFrameCount
+(JNIEnv * env, jobject caller)
+{
+	jni::VideoFrameRing * ring = GetHandle<jni::VideoFrameRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jlong>(ring->getFrameCount());
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoFrameRing_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::VideoFrameRing * ring = GetHandle<jni::VideoFrameRing>(env, caller);
+	CHECK_HANDLE(ring);
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+
+	// Capture sinks may still hold a reference.
+	ring->Release();
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_video_VideoFrameRing_initialize
+(JNIEnv * env, jobject caller, jobjectArray slots, jobject timestamps, jint width, jint height, jobject jformat)
+{
+	try {
+		auto format = jni::JavaEnums::toNative<jni::VideoFrameRing::Format>(env, jformat);
+
+		rtc::scoped_refptr<jni::VideoFrameRing> ring = new rtc::RefCountedObject<jni::VideoFrameRing>(env,
+			jni::JavaLocalRef<jobjectArray>(env, slots), jni::JavaLocalRef<jobject>(env, timestamps),
+			static_cast<int>(width), static_cast<int>(height), format);
+
+		SetHandle(env, caller, ring.release());
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+}
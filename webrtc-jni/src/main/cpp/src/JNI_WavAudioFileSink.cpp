@@ -0,0 +1,74 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_WavAudioFileSink.h"
+#include "JavaRef.h"
+#include "JavaString.h"
+#include "JavaUtils.h"
+
+#include "media/audio/WavAudioFileSink.h"
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSink_onRecordedData
+(JNIEnv * env, jobject caller, jbyteArray audioSamples, jint nSamples, jint nBytesPerSample, jint nChannels, jint samplesPerSec, jint totalDelayMS, jint clockDrift)
+{
+	jni::WavAudioFileSink * sink = GetHandle<jni::WavAudioFileSink>(env, caller);
+	CHECK_HANDLE(sink);
+
+	uint32_t newMicLevel = 0;
+
+	jbyte * samplesPtr = env->GetByteArrayElements(audioSamples, nullptr);
+
+	sink->RecordedDataIsAvailable(samplesPtr, nSamples, nBytesPerSample, nChannels, samplesPerSec, totalDelayMS, clockDrift, 0, false, newMicLevel);
+
+	env->ReleaseByteArrayElements(audioSamples, samplesPtr, JNI_ABORT);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSink_onData
+(JNIEnv * env, jobject caller, jbyteArray data, jint bitsPerSample, jint sampleRate, jint channels, jint frames)
+{
+	jni::WavAudioFileSink * sink = GetHandle<jni::WavAudioFileSink>(env, caller);
+	CHECK_HANDLE(sink);
+
+	jbyte * dataPtr = env->GetByteArrayElements(data, nullptr);
+
+	sink->OnData(dataPtr, bitsPerSample, sampleRate, channels, frames);
+
+	env->ReleaseByteArrayElements(data, dataPtr, JNI_ABORT);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSink_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::WavAudioFileSink * sink = GetHandle<jni::WavAudioFileSink>(env, caller);
+	CHECK_HANDLE(sink);
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+
+	delete sink;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSink_initialize
+(JNIEnv * env, jobject caller, jstring jFileName)
+{
+	std::string fileName = jni::JavaString::toNative(env, jni::JavaLocalRef<jstring>(env, jFileName));
+
+	try {
+		SetHandle(env, caller, new jni::WavAudioFileSink(fileName));
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_WavAudioFileSource.h"
+#include "JavaRef.h"
+#include "JavaString.h"
+#include "JavaUtils.h"
+
+#include "media/audio/WavAudioFileSource.h"
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSource_onPlaybackData
+(JNIEnv * env, jobject caller, jbyteArray audioSamples, jint nSamples, jint nBytesPerSample, jint nChannels, jint samplesPerSec)
+{
+	jni::AudioSource * source = GetHandle<jni::AudioSource>(env, caller);
+	CHECK_HANDLEV(source, 0);
+
+	size_t nSamplesOut = 0;
+	int64_t elapsedTimeMs = 0;
+	int64_t ntpTimeMs = 0;
+
+	jbyte * samplesPtr = env->GetByteArrayElements(audioSamples, nullptr);
+
+	source->NeedMorePlayData(nSamples, nBytesPerSample, nChannels, samplesPerSec, samplesPtr, nSamplesOut, &elapsedTimeMs, &ntpTimeMs);
+
+	env->ReleaseByteArrayElements(audioSamples, samplesPtr, 0);
+
+	return static_cast<jint>(nSamplesOut);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSource_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioSource * source = GetHandle<jni::AudioSource>(env, caller);
+	CHECK_HANDLE(source);
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+
+	delete source;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_WavAudioFileSource_initialize
+(JNIEnv * env, jobject caller, jstring jFileName, jint sampleRate, jint channels, jboolean loop)
+{
+	std::string fileName = jni::JavaString::toNative(env, jni::JavaLocalRef<jstring>(env, jFileName));
+
+	try {
+		jni::AudioSource * source = new jni::WavAudioFileSource(fileName, sampleRate, channels, loop);
+
+		SetHandle(env, caller, source);
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+}
@@ -60,5 +60,6 @@ JNIEXPORT void JNICALL JNI_OnUnload(JavaVM * vm, void * reserved)
 		}
 
 		delete javaContext;
+		javaContext = nullptr;
 	}
 }
@@ -17,6 +17,8 @@
 #include "WebRTCContext.h"
 #include "api/DataBufferFactory.h"
 #include "api/RTCStats.h"
+#include "media/video/VideoFrameRing.h"
+#include "rtc/EmulatedNetwork.h"
 #include "Exception.h"
 #include "JavaClassLoader.h"
 #include "JavaError.h"
@@ -27,6 +29,7 @@
 
 #include "api/peer_connection_interface.h"
 #include "modules/desktop_capture/desktop_capturer.h"
+#include "modules/video_capture/video_capture_defines.h"
 #include "rtc_base/ssl_adapter.h"
 
 #ifdef _WIN32
@@ -80,6 +83,8 @@ namespace jni
 		JavaEnums::add<webrtc::SdpType>(env, PKG"RTCSdpType");
 		JavaEnums::add<webrtc::AudioDeviceModule::AudioLayer>(env, PKG_AUDIO"AudioLayer");
 		JavaEnums::add<webrtc::AudioProcessing::Config::NoiseSuppression::Level>(env, PKG_AUDIO"AudioProcessingConfig$NoiseSuppression$Level");
+		JavaEnums::add<webrtc::VideoType>(env, PKG_VIDEO"VideoType");
+		JavaEnums::add<jni::VideoFrameRing::Format>(env, PKG_VIDEO"VideoFrameRing$Format");
 		JavaEnums::add<jni::RTCStats::RTCStatsType>(env, PKG"RTCStatsType");
 
 		JavaFactories::add<webrtc::AudioSourceInterface>(env, PKG_MEDIA"audio/AudioTrackSource");
@@ -87,6 +92,7 @@ namespace jni
 		JavaFactories::add<webrtc::VideoTrackInterface>(env, PKG_MEDIA"video/VideoTrack");
 		JavaFactories::add<webrtc::MediaStreamInterface>(env, PKG_MEDIA"MediaStream");
 		JavaFactories::add<webrtc::DataChannelInterface>(env, PKG"RTCDataChannel");
+		JavaFactories::add<jni::EmulatedNetwork>(env, PKG"EmulatedNetwork");
 		JavaFactories::add<webrtc::DtlsTransportInterface>(env, PKG"RTCDtlsTransport");
 		JavaFactories::add<webrtc::IceTransportInterface>(env, PKG"RTCIceTransport");
 		JavaFactories::add<webrtc::PeerConnectionInterface>(env, PKG"RTCPeerConnection");
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api/RTCBandwidthEstimationObserver.h"
+#include "JavaClasses.h"
+#include "JNI_WebRTC.h"
+
+#include "api/stats/rtcstats_objects.h"
+#include "rtc_base/thread.h"
+
+#include <cmath>
+
+namespace jni
+{
+	// Changes below this fraction of the last reported estimate are not reported.
+	static const double kMinRelativeChange = 0.05;
+
+	static rtc::Thread * PollThread()
+	{
+		// Shared by all observers, polling only posts a stats request.
+		static std::unique_ptr<rtc::Thread> thread = []() {
+			auto t = rtc::Thread::Create();
+			t->SetName("bwe_observer", nullptr);
+			t->Start();
+			return t;
+		}();
+
+		return thread.get();
+	}
+
+	RTCBandwidthEstimationObserver::RTCBandwidthEstimationObserver(JNIEnv * env, const JavaGlobalRef<jobject> & observer,
+		webrtc::PeerConnectionInterface * pc, int intervalMs) :
+		observer(observer),
+		javaClass(JavaClasses::get<JavaRTCBandwidthEstimationObserverClass>(env)),
+		pc(pc),
+		intervalMs(intervalMs),
+		running(false),
+		lastBitrate(-1)
+	{
+	}
+
+	void RTCBandwidthEstimationObserver::start()
+	{
+		running = true;
+
+		rtc::scoped_refptr<RTCBandwidthEstimationObserver> self(this);
+
+		PollThread()->PostTask(RTC_FROM_HERE, [self] { self->poll(); });
+	}
+
+	void RTCBandwidthEstimationObserver::stop()
+	{
+		running = false;
+	}
+
+	void RTCBandwidthEstimationObserver::poll()
+	{
+		if (!running) {
+			return;
+		}
+
+		pc->GetStats(this);
+
+		rtc::scoped_refptr<RTCBandwidthEstimationObserver> self(this);
+
+		PollThread()->PostDelayedTask(RTC_FROM_HERE, [self] { self->poll(); }, static_cast<uint32_t>(intervalMs));
+	}
+
+	void RTCBandwidthEstimationObserver::OnStatsDelivered(const rtc::scoped_refptr<const webrtc::RTCStatsReport> & report)
+	{
+		if (!running) {
+			return;
+		}
+
+		double bitrate = -1;
+
+		for (const auto * transport : report->GetStatsOfType<webrtc::RTCTransportStats>()) {
+			if (!transport->selected_candidate_pair_id.is_defined()) {
+				continue;
+			}
+
+			const webrtc::RTCStats * stats = report->Get(*transport->selected_candidate_pair_id);
+
+			if (!stats || stats->type() != webrtc::RTCIceCandidatePairStats::kType) {
+				continue;
+			}
+
+			const auto & pair = stats->cast_to<webrtc::RTCIceCandidatePairStats>();
+
+			if (pair.available_outgoing_bitrate.is_defined()) {
+				bitrate = *pair.available_outgoing_bitrate;
+				break;
+			}
+		}
+
+		if (bitrate < 0) {
+			return;
+		}
+		if (lastBitrate >= 0 && std::abs(bitrate - lastBitrate) < lastBitrate * kMinRelativeChange) {
+			return;
+		}
+
+		lastBitrate = bitrate;
+
+		JNIEnv * env = AttachCurrentThread();
+
+		env->CallVoidMethod(observer, javaClass->onBandwidthEstimate, static_cast<jlong>(bitrate));
+	}
+
+	RTCBandwidthEstimationObserver::JavaRTCBandwidthEstimationObserverClass::JavaRTCBandwidthEstimationObserverClass(JNIEnv * env)
+	{
+		jclass cls = FindClass(env, PKG"RTCBandwidthEstimationObserver");
+
+		onBandwidthEstimate = GetMethod(env, cls, "onBandwidthEstimate", "(J)V");
+	}
+}
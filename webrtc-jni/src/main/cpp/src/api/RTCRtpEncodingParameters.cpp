@@ -20,6 +20,7 @@
 #include "JavaObject.h"
 #include "JavaPrimitive.h"
 #include "JavaRef.h"
+#include "JavaString.h"
 #include "JNI_WebRTC.h"
 
 namespace jni
@@ -36,6 +37,9 @@ namespace jni
 			if (parameters.ssrc.has_value()) {
 				env->SetObjectField(object, javaClass->ssrc, Long::create(env, parameters.ssrc.value()));
 			}
+			if (!parameters.rid.empty()) {
+				env->SetObjectField(object, javaClass->rid, JavaString::toJava(env, parameters.rid).get());
+			}
 			if (parameters.min_bitrate_bps.has_value()) {
 				env->SetObjectField(object, javaClass->minBitrate, Integer::create(env, parameters.min_bitrate_bps.value()));
 			}
@@ -48,6 +52,9 @@ namespace jni
 			if (parameters.scale_resolution_down_by.has_value()) {
 				env->SetObjectField(object, javaClass->scaleResolution, Double::create(env, parameters.scale_resolution_down_by.value()));
 			}
+			if (parameters.scalability_mode.has_value()) {
+				env->SetObjectField(object, javaClass->scalabilityMode, JavaString::toJava(env, parameters.scalability_mode.value()).get());
+			}
 
 			return JavaLocalRef<jobject>(env, object);
 		}
@@ -60,10 +67,12 @@ namespace jni
 
 			auto active = obj.getObject(javaClass->active);
 			auto ssrc = obj.getObject(javaClass->ssrc);
+			auto rid = obj.getString(javaClass->rid);
 			auto minBitrate = obj.getObject(javaClass->minBitrate);
 			auto maxBitrate = obj.getObject(javaClass->maxBitrate);
 			auto maxFramerate = obj.getObject(javaClass->maxFramerate);
 			auto scaleResolution = obj.getObject(javaClass->scaleResolution);
+			auto scalabilityMode = obj.getString(javaClass->scalabilityMode);
 
 			webrtc::RtpEncodingParameters params;
 
@@ -73,6 +82,9 @@ namespace jni
 			if (ssrc.get()) {
 				params.ssrc = static_cast<uint32_t>(Long::getValue(env, ssrc));
 			}
+			if (rid.get()) {
+				params.rid = JavaString::toNative(env, rid);
+			}
 			if (minBitrate.get()) {
 				params.min_bitrate_bps.emplace(Integer::getValue(env, minBitrate));
 			}
@@ -85,6 +97,9 @@ namespace jni
 			if (scaleResolution.get()) {
 				params.scale_resolution_down_by.emplace(Double::getValue(env, scaleResolution));
 			}
+			if (scalabilityMode.get()) {
+				params.scalability_mode.emplace(JavaString::toNative(env, scalabilityMode));
+			}
 
 			return params;
 		}
@@ -96,11 +111,13 @@ namespace jni
 			ctor = GetMethod(env, cls, "<init>", "()V");
 			
 			ssrc = GetFieldID(env, cls, "ssrc", LONG_SIG);
+			rid = GetFieldID(env, cls, "rid", STRING_SIG);
 			active = GetFieldID(env, cls, "active", BOOLEAN_SIG);
 			minBitrate = GetFieldID(env, cls, "minBitrate", INTEGER_SIG);
 			maxBitrate = GetFieldID(env, cls, "maxBitrate", INTEGER_SIG);
 			maxFramerate = GetFieldID(env, cls, "maxFramerate", DOUBLE_SIG);
 			scaleResolution = GetFieldID(env, cls, "scaleResolutionDownBy", DOUBLE_SIG);
+			scalabilityMode = GetFieldID(env, cls, "scalabilityMode", STRING_SIG);
 		}
 	}
 }
\ No newline at end of file
@@ -39,8 +39,14 @@ namespace jni
 
 			webrtc::RtpTransceiverInit init;
 			init.direction = JavaEnums::toNative<webrtc::RtpTransceiverDirection>(env, obj.getObject(javaClass->direction));
-			init.stream_ids = JavaList::toStringVector(env, ids);
-			init.send_encodings = JavaList::toVector(env, encodings, &RTCRtpEncodingParameters::toNative);
+
+			if (ids) {
+				init.stream_ids = JavaList::toStringVector(env, ids);
+			}
+			if (encodings) {
+				// One encoding per simulcast layer, identified by its rid.
+				init.send_encodings = JavaList::toVector(env, encodings, &RTCRtpEncodingParameters::toNative);
+			}
 
 			return init;
 		}
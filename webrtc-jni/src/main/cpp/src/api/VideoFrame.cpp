@@ -55,6 +55,9 @@ namespace jni
 			jobject jBuffer = env->NewObject(javaClass->cls, javaClass->ctor, buffer->width(), buffer->height(),
 				yBuffer, buffer->StrideY(), uBuffer, buffer->StrideU(), vBuffer, buffer->StrideV());
 
+			// The Java object owns one reference, released with NativeI420Buffer.release().
+			buffer->AddRef();
+
 			SetHandle(env, jBuffer, buffer.get());
 
 			env->DeleteLocalRef(yBuffer);
@@ -51,6 +51,9 @@ namespace jni
 		env->CallVoidMethod(sink, javaClass->onFrame, jFrame);
 		env->DeleteLocalRef(jBuffer);
 		env->DeleteLocalRef(jFrame);
+
+		// Drop the reference of the Java frame, consumers keep the frame with retain().
+		i420Buffer->Release();
 	}
 
 	VideoTrackSink::JavaVideoTrackSinkClass::JavaVideoTrackSinkClass(JNIEnv * env)
@@ -0,0 +1,195 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/AsyncFileWriter.h"
+#include "Exception.h"
+
+#include "rtc_base/logging.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#endif
+
+namespace jni
+{
+	AsyncFileWriter::AsyncFileWriter(const std::string & fileName, size_t blockSize, size_t preallocSize) :
+		blockSize(blockSize),
+		file(nullptr),
+		written(0),
+		closed(false)
+	{
+		file = std::fopen(fileName.c_str(), "wb");
+
+		if (!file) {
+			throw Exception("Open file %s failed", fileName.c_str());
+		}
+
+		// Blocks are already large, no need for another copy in the stdio buffer.
+		std::setvbuf(file, nullptr, _IONBF, 0);
+
+#if defined(__linux__)
+		if (preallocSize > 0) {
+			// Reserve disk space to reduce fragmentation, without changing the file size.
+			if (fallocate(fileno(file), FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(preallocSize)) != 0) {
+				RTC_LOG(LS_WARNING) << "Preallocate file " << fileName << " failed";
+			}
+		}
+#endif
+
+		block.reserve(blockSize);
+
+		thread = std::thread(&AsyncFileWriter::run, this);
+	}
+
+	AsyncFileWriter::~AsyncFileWriter()
+	{
+		close();
+	}
+
+	void AsyncFileWriter::write(const void * data, size_t size)
+	{
+		const uint8_t * ptr = static_cast<const uint8_t *>(data);
+
+		std::unique_lock<std::mutex> lock(mutex);
+
+		if (closed) {
+			return;
+		}
+
+		written += size;
+
+		while (size > 0) {
+			size_t length = std::min(size, blockSize - block.size());
+
+			block.insert(block.end(), ptr, ptr + length);
+
+			ptr += length;
+			size -= length;
+
+			if (block.size() == blockSize) {
+				pushBlock();
+			}
+		}
+	}
+
+	void AsyncFileWriter::writeAt(size_t offset, const void * data, size_t size)
+	{
+		const uint8_t * ptr = static_cast<const uint8_t *>(data);
+
+		std::unique_lock<std::mutex> lock(mutex);
+
+		patches.push_back({ offset, std::vector<uint8_t>(ptr, ptr + size) });
+	}
+
+	size_t AsyncFileWriter::position() const
+	{
+		return written;
+	}
+
+	void AsyncFileWriter::close()
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+
+			if (closed) {
+				return;
+			}
+
+			if (!block.empty()) {
+				pushBlock();
+			}
+
+			closed = true;
+		}
+
+		condition.notify_one();
+
+		if (thread.joinable()) {
+			try {
+				thread.join();
+			}
+			catch (const std::system_error & error) {
+				RTC_LOG(LS_ERROR) << "Thread Join Error: " << error.what();
+			}
+		}
+
+		for (const Patch & patch : patches) {
+			if (std::fseek(file, static_cast<long>(patch.offset), SEEK_SET) == 0) {
+				std::fwrite(patch.data.data(), 1, patch.data.size(), file);
+			}
+		}
+
+		std::fclose(file);
+		file = nullptr;
+	}
+
+	void AsyncFileWriter::pushBlock()
+	{
+		pending.push_back(std::move(block));
+
+		if (!freeBlocks.empty()) {
+			block = std::move(freeBlocks.back());
+			freeBlocks.pop_back();
+		}
+		else {
+			block = std::vector<uint8_t>();
+			block.reserve(blockSize);
+		}
+
+		condition.notify_one();
+	}
+
+	void AsyncFileWriter::run()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		while (true) {
+			if (!condition.wait_for(lock, std::chrono::seconds(1), [this] { return closed || !pending.empty(); })) {
+				// Flush partially filled blocks regularly to limit data loss.
+				if (!block.empty()) {
+					pushBlock();
+				}
+			}
+
+			if (pending.empty()) {
+				if (closed) {
+					break;
+				}
+
+				continue;
+			}
+
+			std::vector<uint8_t> data = std::move(pending.front());
+			pending.pop_front();
+
+			lock.unlock();
+
+			if (std::fwrite(data.data(), 1, data.size(), file) != data.size()) {
+				RTC_LOG(LS_ERROR) << "Write " << data.size() << " bytes to file failed";
+			}
+
+			data.clear();
+
+			lock.lock();
+
+			freeBlocks.push_back(std::move(data));
+		}
+	}
+}
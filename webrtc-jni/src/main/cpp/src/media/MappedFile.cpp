@@ -0,0 +1,187 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/MappedFile.h"
+#include "Exception.h"
+
+#include <iterator>
+#include <map>
+#include <mutex>
+
+#if defined(WEBRTC_WIN)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace jni
+{
+	static std::mutex cacheMutex;
+	static std::map<std::string, std::weak_ptr<MappedFile>> cache;
+
+	std::shared_ptr<MappedFile> MappedFile::open(const std::string & fileName)
+	{
+		std::unique_lock<std::mutex> lock(cacheMutex);
+
+		std::shared_ptr<MappedFile> file = cache[fileName].lock();
+
+		if (!file) {
+			file = std::shared_ptr<MappedFile>(new MappedFile(fileName));
+
+			cache[fileName] = file;
+
+			// Drop entries of files that are no longer used.
+			for (auto it = cache.begin(); it != cache.end();) {
+				it = it->second.expired() ? cache.erase(it) : std::next(it);
+			}
+		}
+
+		return file;
+	}
+
+#if defined(WEBRTC_WIN)
+	MappedFile::MappedFile(const std::string & fileName) :
+		address(nullptr),
+		length(0),
+		fileHandle(INVALID_HANDLE_VALUE),
+		mappingHandle(nullptr)
+	{
+		fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (fileHandle == INVALID_HANDLE_VALUE) {
+			throw Exception("Open file %s failed", fileName.c_str());
+		}
+
+		LARGE_INTEGER fileSize;
+
+		if (!GetFileSizeEx(fileHandle, &fileSize)) {
+			CloseHandle(fileHandle);
+			throw Exception("Get size of file %s failed", fileName.c_str());
+		}
+
+		length = static_cast<size_t>(fileSize.QuadPart);
+
+		if (length == 0) {
+			return;
+		}
+
+		mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (mappingHandle == nullptr) {
+			CloseHandle(fileHandle);
+			throw Exception("Map file %s failed", fileName.c_str());
+		}
+
+		address = static_cast<const uint8_t *>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+		if (address == nullptr) {
+			CloseHandle(mappingHandle);
+			CloseHandle(fileHandle);
+			throw Exception("Map file %s failed", fileName.c_str());
+		}
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (address) {
+			UnmapViewOfFile(address);
+		}
+		if (mappingHandle) {
+			CloseHandle(mappingHandle);
+		}
+		if (fileHandle != INVALID_HANDLE_VALUE) {
+			CloseHandle(fileHandle);
+		}
+	}
+
+	void MappedFile::prefetch() const
+	{
+		if (length == 0) {
+			return;
+		}
+
+		WIN32_MEMORY_RANGE_ENTRY range;
+		range.VirtualAddress = const_cast<uint8_t *>(address);
+		range.NumberOfBytes = length;
+
+		PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+	}
+#else
+	MappedFile::MappedFile(const std::string & fileName) :
+		address(nullptr),
+		length(0)
+	{
+		int fd = ::open(fileName.c_str(), O_RDONLY);
+
+		if (fd < 0) {
+			throw Exception("Open file %s failed", fileName.c_str());
+		}
+
+		struct stat fileStat;
+
+		if (fstat(fd, &fileStat) != 0) {
+			::close(fd);
+			throw Exception("Get size of file %s failed", fileName.c_str());
+		}
+
+		length = static_cast<size_t>(fileStat.st_size);
+
+		if (length > 0) {
+			void * mapping = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+
+			if (mapping == MAP_FAILED) {
+				::close(fd);
+				throw Exception("Map file %s failed", fileName.c_str());
+			}
+
+			address = static_cast<const uint8_t *>(mapping);
+
+			madvise(mapping, length, MADV_SEQUENTIAL);
+		}
+
+		// The mapping stays valid after the descriptor is closed.
+		::close(fd);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (address) {
+			munmap(const_cast<uint8_t *>(address), length);
+		}
+	}
+
+	void MappedFile::prefetch() const
+	{
+		if (address) {
+			madvise(const_cast<uint8_t *>(address), length, MADV_WILLNEED);
+		}
+	}
+#endif
+
+	const uint8_t * MappedFile::data() const
+	{
+		return address;
+	}
+
+	size_t MappedFile::size() const
+	{
+		return length;
+	}
+}
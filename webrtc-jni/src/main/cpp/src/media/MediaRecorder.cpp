@@ -0,0 +1,167 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/MediaRecorder.h"
+#include "Exception.h"
+
+#include "absl/strings/match.h"
+
+namespace jni
+{
+	MediaRecorder::MediaRecorder(cricket::MediaType mediaType) :
+		mediaType(mediaType),
+		payloadType(-1),
+		recordPayloadType(-1)
+	{
+	}
+
+	MediaRecorder::~MediaRecorder()
+	{
+		stop();
+	}
+
+	void MediaRecorder::start(const std::string & fileName, const std::string & codecName, int channels, int payloadType)
+	{
+		// Open the new file before taking the lock to not stall the network thread.
+		std::unique_ptr<IvfFileWriter> newVideoWriter;
+		std::unique_ptr<OggOpusFileWriter> newAudioWriter;
+
+		if (mediaType == cricket::MEDIA_TYPE_VIDEO) {
+			newVideoWriter = std::make_unique<IvfFileWriter>(fileName, codecName);
+		}
+		else if (mediaType == cricket::MEDIA_TYPE_AUDIO) {
+			if (!absl::EqualsIgnoreCase(codecName, "opus")) {
+				throw Exception("Ogg: Unsupported codec %s", codecName.c_str());
+			}
+
+			newAudioWriter = std::make_unique<OggOpusFileWriter>(fileName, static_cast<uint8_t>(channels));
+		}
+		else {
+			throw Exception("Recording is supported only for audio and video receivers");
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(writerMutex);
+
+			videoWriter.swap(newVideoWriter);
+			audioWriter.swap(newAudioWriter);
+			recordPayloadType = payloadType;
+		}
+
+		// Close the previous file outside the lock, this flushes all pending blocks.
+		newVideoWriter.reset();
+		newAudioWriter.reset();
+	}
+
+	void MediaRecorder::stop()
+	{
+		std::unique_ptr<IvfFileWriter> oldVideoWriter;
+		std::unique_ptr<OggOpusFileWriter> oldAudioWriter;
+
+		{
+			std::unique_lock<std::mutex> lock(writerMutex);
+
+			oldVideoWriter.swap(videoWriter);
+			oldAudioWriter.swap(audioWriter);
+		}
+	}
+
+	bool MediaRecorder::isRecording()
+	{
+		std::unique_lock<std::mutex> lock(writerMutex);
+
+		return videoWriter || audioWriter;
+	}
+
+	int MediaRecorder::getPayloadType() const
+	{
+		return payloadType.load(std::memory_order_relaxed);
+	}
+
+	void MediaRecorder::Transform(std::unique_ptr<webrtc::TransformableFrameInterface> frame)
+	{
+		int framePayloadType = -1;
+
+		// Video frames do not expose their payload type to transformers in this WebRTC version.
+		if (mediaType == cricket::MEDIA_TYPE_AUDIO) {
+			auto audioFrame = static_cast<webrtc::TransformableAudioFrameInterface *>(frame.get());
+
+			framePayloadType = audioFrame->GetHeader().payloadType;
+			payloadType.store(framePayloadType, std::memory_order_relaxed);
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(writerMutex);
+
+			rtc::ArrayView<const uint8_t> data = frame->GetData();
+
+			if (videoWriter) {
+				auto videoFrame = static_cast<webrtc::TransformableVideoFrameInterface *>(frame.get());
+				const webrtc::VideoFrameMetadata & metadata = videoFrame->GetMetadata();
+
+				videoWriter->writeFrame(data.data(), data.size(), frame->GetTimestamp(),
+					videoFrame->IsKeyFrame(), metadata.GetWidth(), metadata.GetHeight());
+			}
+			else if (audioWriter && framePayloadType == recordPayloadType) {
+				// Other payloads, e.g. comfort noise or a switched codec, are no Opus packets.
+				audioWriter->writePacket(data.data(), data.size(), frame->GetTimestamp());
+			}
+		}
+
+		// Pass the frame on to the decoder unmodified.
+		rtc::scoped_refptr<webrtc::TransformedFrameCallback> sink;
+
+		{
+			std::unique_lock<std::mutex> lock(callbackMutex);
+
+			auto it = sinkCallbacks.find(frame->GetSsrc());
+
+			sink = (it != sinkCallbacks.end()) ? it->second : callback;
+		}
+
+		if (sink) {
+			sink->OnTransformedFrame(std::move(frame));
+		}
+	}
+
+	void MediaRecorder::RegisterTransformedFrameCallback(rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback)
+	{
+		std::unique_lock<std::mutex> lock(callbackMutex);
+
+		this->callback = callback;
+	}
+
+	void MediaRecorder::RegisterTransformedFrameSinkCallback(rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback, uint32_t ssrc)
+	{
+		std::unique_lock<std::mutex> lock(callbackMutex);
+
+		sinkCallbacks[ssrc] = callback;
+	}
+
+	void MediaRecorder::UnregisterTransformedFrameCallback()
+	{
+		std::unique_lock<std::mutex> lock(callbackMutex);
+
+		callback = nullptr;
+	}
+
+	void MediaRecorder::UnregisterTransformedFrameSinkCallback(uint32_t ssrc)
+	{
+		std::unique_lock<std::mutex> lock(callbackMutex);
+
+		sinkCallbacks.erase(ssrc);
+	}
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace jni
+{
+	ThreadPool::ThreadPool(size_t threads) :
+		stopped(false)
+	{
+		for (size_t i = 0; i < threads; ++i) {
+			this->threads.emplace_back(&ThreadPool::run, this);
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			stopped = true;
+		}
+
+		condition.notify_all();
+
+		for (auto & thread : threads) {
+			thread.join();
+		}
+	}
+
+	ThreadPool & ThreadPool::shared()
+	{
+		// The calling thread also works, leave one core for it.
+		static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+
+		return pool;
+	}
+
+	size_t ThreadPool::size() const
+	{
+		return threads.size();
+	}
+
+	void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)> & func)
+	{
+		struct State
+		{
+			std::function<void(size_t)> func;
+			size_t count;
+			std::atomic<size_t> next;
+			std::atomic<size_t> done;
+			std::mutex mutex;
+			std::condition_variable condition;
+		};
+
+		if (count == 0) {
+			return;
+		}
+
+		// Shared with the workers, which may still touch it after this call returned.
+		auto state = std::make_shared<State>();
+		state->func = func;
+		state->count = count;
+		state->next = 0;
+		state->done = 0;
+
+		auto work = [state]() {
+			size_t index;
+
+			while ((index = state->next++) < state->count) {
+				state->func(index);
+
+				if (++state->done == state->count) {
+					std::unique_lock<std::mutex> lock(state->mutex);
+					state->condition.notify_one();
+				}
+			}
+		};
+
+		size_t helpers = std::min(count - 1, threads.size());
+
+		if (helpers > 0) {
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+
+				for (size_t i = 0; i < helpers; ++i) {
+					tasks.push_back(work);
+				}
+			}
+
+			condition.notify_all();
+		}
+
+		work();
+
+		std::unique_lock<std::mutex> lock(state->mutex);
+		state->condition.wait(lock, [&state] { return state->done == state->count; });
+	}
+
+	void ThreadPool::run()
+	{
+		while (true) {
+			std::function<void()> task;
+
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+
+				condition.wait(lock, [this] { return stopped || !tasks.empty(); });
+
+				if (stopped && tasks.empty()) {
+					return;
+				}
+
+				task = std::move(tasks.front());
+				tasks.pop_front();
+			}
+
+			task();
+		}
+	}
+}
@@ -16,10 +16,13 @@
 
 #include "media/audio/AudioConverter.h"
 
+#include <cstring>
 #include <memory>
+#include <vector>
 
-#include "audio/utility/channel_mixer.h"
+#include "audio/utility/channel_mixing_matrix.h"
 #include "common_audio/resampler/include/push_resampler.h"
+#include "rtc_base/numerics/safe_conversions.h"
 
 namespace jni
 {
@@ -49,14 +52,14 @@ namespace jni
             ChannelConverter(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels)
                 : AudioConverter(srcFrames, srcChannels, dstFrames, dstChannels)
             {
-                webrtc::ChannelLayout srcLayout = webrtc::GuessChannelLayout(static_cast<int>(srcChannels));
-                webrtc::ChannelLayout dstLayout = webrtc::GuessChannelLayout(static_cast<int>(dstChannels));
+                int srcCount = static_cast<int>(srcChannels);
+                int dstCount = static_cast<int>(dstChannels);
 
-                mixer = std::make_unique<webrtc::ChannelMixer>(srcLayout, dstLayout);
-                frame = std::make_unique<webrtc::AudioFrame>();
+                webrtc::ChannelLayout srcLayout = webrtc::GuessChannelLayout(srcCount);
+                webrtc::ChannelLayout dstLayout = webrtc::GuessChannelLayout(dstCount);
 
-                frame->samples_per_channel_ = srcFrames;
-                frame->num_channels_ = srcChannels;
+                webrtc::ChannelMixingMatrix matrixBuilder(srcLayout, srcCount, dstLayout, dstCount);
+                matrixBuilder.CreateTransformationMatrix(&matrix);
             }
 
             ~ChannelConverter() override
@@ -66,16 +69,38 @@ namespace jni
             void convert(const int16_t * src, size_t srcSize, int16_t * dst, size_t dstSize) override {
                 checkSizes(srcSize, dstSize);
 
-                std::memcpy(frame->mutable_data(), src, srcFrames * srcChannels * sizeof(int16_t));
+                // Mix directly between the interleaved buffers, without an intermediate frame.
+                if (srcChannels == 1 && dstChannels == 2) {
+                    for (size_t i = 0; i < srcFrames; ++i) {
+                        dst[2 * i] = src[i];
+                        dst[2 * i + 1] = src[i];
+                    }
+                }
+                else if (srcChannels == 2 && dstChannels == 1) {
+                    for (size_t i = 0; i < srcFrames; ++i) {
+                        dst[i] = static_cast<int16_t>((src[2 * i] + src[2 * i + 1]) >> 1);
+                    }
+                }
+                else {
+                    for (size_t i = 0; i < srcFrames; ++i) {
+                        const int16_t * in = src + i * srcChannels;
+                        int16_t * out = dst + i * dstChannels;
 
-                mixer->Transform(frame.get());
+                        for (size_t o = 0; o < dstChannels; ++o) {
+                            float acc = 0;
 
-                std::memcpy(dst, frame->data(), dstFrames * dstChannels * sizeof(int16_t));
+                            for (size_t c = 0; c < srcChannels; ++c) {
+                                acc += matrix[o][c] * in[c];
+                            }
+
+                            out[o] = rtc::saturated_cast<int16_t>(acc);
+                        }
+                    }
+                }
             }
 
         private:
-            std::unique_ptr<webrtc::ChannelMixer> mixer;
-            std::unique_ptr<webrtc::AudioFrame> frame;
+            std::vector<std::vector<float>> matrix;
     };
 
 
@@ -106,7 +131,9 @@ namespace jni
     class CompositionConverter : public AudioConverter {
         public:
             explicit CompositionConverter(std::vector<std::unique_ptr<AudioConverter>> converters_)
-                : converters(std::move(converters_))
+                : AudioConverter(converters_.front()->getSrcFrames(), converters_.front()->getSrcChannels(),
+                    converters_.back()->getDstFrames(), converters_.back()->getDstChannels()),
+                converters(std::move(converters_))
             {
                 RTC_CHECK_GE(converters.size(), 2);
 
@@ -123,9 +150,9 @@ namespace jni
             void convert(const int16_t * src, size_t srcSize, int16_t * dst, size_t dstSize) override {
                 converters.front()->convert(src, srcSize, buffers.front().data(), buffers.front().size());
 
-                for (size_t i = 2; i < converters.size(); ++i) {
-                    auto & src_buffer = buffers[i - 2];
-                    auto & dst_buffer = buffers[i - 1];
+                for (size_t i = 1; i < converters.size() - 1; ++i) {
+                    auto & src_buffer = buffers[i - 1];
+                    auto & dst_buffer = buffers[i];
 
                     converters[i]->convert(src_buffer.data(), src_buffer.size(), dst_buffer.data(), dst_buffer.size());
                 }
@@ -177,14 +204,6 @@ namespace jni
         return converter;
 	}
 
-    AudioConverter::AudioConverter() :
-        srcFrames(0),
-        srcChannels(0),
-        dstFrames(0),
-        dstChannels(0)
-    {
-    }
-
     AudioConverter::AudioConverter(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels) :
         srcFrames(srcFrames),
         srcChannels(srcChannels),
@@ -193,6 +212,21 @@ namespace jni
     {
     }
 
+    size_t AudioConverter::convertFrames(const int16_t * src, size_t srcSize, int16_t * dst, size_t dstCapacity) {
+        const size_t srcFrameSize = srcChannels * srcFrames;
+        const size_t dstFrameSize = dstChannels * dstFrames;
+        const size_t frames = srcFrameSize > 0 ? srcSize / srcFrameSize : 0;
+
+        RTC_CHECK_EQ(srcSize, frames * srcFrameSize);
+        RTC_CHECK_GE(dstCapacity, frames * dstFrameSize);
+
+        for (size_t i = 0; i < frames; ++i) {
+            convert(src + i * srcFrameSize, srcFrameSize, dst + i * dstFrameSize, dstFrameSize);
+        }
+
+        return frames * dstFrameSize;
+    }
+
     void AudioConverter::checkSizes(size_t srcSize, size_t dstCapacity) const {
         RTC_CHECK_EQ(srcSize, srcChannels * srcFrames);
         RTC_CHECK_GE(dstCapacity, dstChannels * dstFrames);
@@ -22,6 +22,8 @@
 #include "JavaUtils.h"
 #include "JNI_WebRTC.h"
 
+#include "api/audio/audio_frame.h"
+
 namespace jni
 {
 	namespace AudioProcessing
@@ -45,11 +47,82 @@ namespace jni
 			statsObj.setDouble(javaStatsClass->residualEchoLikelihoodRecentMax, stats.residual_echo_likelihood_recent_max.value_or(0));
 		}
 
+		void writeFrameStats(const webrtc::AudioProcessingStats & stats, int32_t * dst)
+		{
+			enum Flags : int32_t {
+				kVoiceDetected = 1,
+				kVoiceAvailable = 1 << 1,
+				kDelayAvailable = 1 << 2
+			};
+
+			int32_t flags = 0;
+
+			if (stats.voice_detected) {
+				flags |= kVoiceAvailable;
+
+				if (*stats.voice_detected) {
+					flags |= kVoiceDetected;
+				}
+			}
+			if (stats.delay_ms) {
+				flags |= kDelayAvailable;
+			}
+
+			dst[0] = flags;
+			dst[1] = stats.delay_ms.value_or(0);
+		}
+
 		JavaAudioProcessingClass::JavaAudioProcessingClass(JNIEnv * env)
 		{
 			cls = FindClass(env, PKG_AUDIO"AudioProcessing");
 
 			stats = GetFieldID(env, cls, "stats", "L" PKG_AUDIO "AudioProcessingStats;");
 		}
+
+		int process(webrtc::AudioProcessing * apm, const int16_t * src, const webrtc::StreamConfig & srcConfig,
+			const webrtc::StreamConfig & dstConfig, int16_t * dst, size_t frames, bool reverse)
+		{
+			const size_t srcFrameSize = srcConfig.num_samples();
+			const size_t dstFrameSize = dstConfig.num_samples();
+
+			// Up-mixing, only mono to stereo. For complex channel layouts a channel mixer is required.
+			const bool upMix = srcConfig.num_channels() == 1 && dstConfig.num_channels() == 2;
+
+			webrtc::StreamConfig inputConfig = srcConfig;
+			int16_t upMixed[webrtc::AudioFrame::kMaxDataSizeSamples];
+
+			if (upMix) {
+				if (srcFrameSize * 2 > webrtc::AudioFrame::kMaxDataSizeSamples) {
+					return webrtc::AudioProcessing::kBadDataLengthError;
+				}
+
+				inputConfig.set_num_channels(2);
+			}
+
+			for (size_t i = 0; i < frames; ++i) {
+				const int16_t * input = src + i * srcFrameSize;
+				int16_t * output = dst + i * dstFrameSize;
+
+				if (upMix) {
+					for (size_t j = 0; j < srcFrameSize; ++j) {
+						upMixed[2 * j] = input[j];
+						upMixed[2 * j + 1] = input[j];
+					}
+
+					input = upMixed;
+				}
+
+				// Will also down-mix if required, e.g. from stereo to mono.
+				int result = reverse
+					? apm->ProcessReverseStream(input, inputConfig, dstConfig, output)
+					: apm->ProcessStream(input, inputConfig, dstConfig, output);
+
+				if (result != webrtc::AudioProcessing::kNoError) {
+					return result;
+				}
+			}
+
+			return webrtc::AudioProcessing::kNoError;
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,212 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/AudioProcessingPool.h"
+#include "media/audio/AudioProcessing.h"
+#include "Exception.h"
+
+#include "rtc_base/logging.h"
+
+#include <algorithm>
+#include <chrono>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace jni
+{
+	AudioProcessingPool::AudioProcessingPool(size_t threads, size_t queueSize) :
+		completions(queueSize * std::max<size_t>(threads, 1)),
+		completionWaiters(0),
+		completionsTaken(0),
+		nextStreamId(0),
+		running(true)
+	{
+		if (threads == 0) {
+			threads = std::max(std::thread::hardware_concurrency(), 1u);
+		}
+
+		for (size_t i = 0; i < threads; ++i) {
+			workers.push_back(std::make_unique<Worker>(queueSize));
+		}
+
+		for (size_t i = 0; i < threads; ++i) {
+			Worker * worker = workers[i].get();
+
+			worker->thread = std::thread(&AudioProcessingPool::run, this, worker);
+
+#if defined(__linux__)
+			// Pin each worker to its own core to keep the APM state in the core's cache.
+			unsigned cores = std::thread::hardware_concurrency();
+
+			if (cores > 0) {
+				cpu_set_t cpuSet;
+				CPU_ZERO(&cpuSet);
+				CPU_SET(i % cores, &cpuSet);
+
+				if (pthread_setaffinity_np(worker->thread.native_handle(), sizeof(cpu_set_t), &cpuSet) != 0) {
+					RTC_LOG(LS_WARNING) << "AudioProcessingPool: Set thread affinity failed";
+				}
+			}
+#endif
+		}
+	}
+
+	AudioProcessingPool::~AudioProcessingPool()
+	{
+		running = false;
+
+		{
+			std::unique_lock<std::mutex> lock(completionMutex);
+
+			completionCondition.notify_all();
+		}
+
+		for (auto & worker : workers) {
+			{
+				std::unique_lock<std::mutex> lock(worker->mutex);
+			}
+
+			worker->condition.notify_one();
+
+			if (worker->thread.joinable()) {
+				worker->thread.join();
+			}
+		}
+	}
+
+	int AudioProcessingPool::addStream(rtc::scoped_refptr<webrtc::AudioProcessing> apm, const webrtc::StreamConfig & inputConfig, const webrtc::StreamConfig & outputConfig)
+	{
+		std::unique_lock<std::mutex> lock(streamMutex);
+
+		int id = nextStreamId++;
+
+		streams[id] = std::make_shared<Stream>(Stream{ id, apm, inputConfig, outputConfig });
+
+		return id;
+	}
+
+	void AudioProcessingPool::removeStream(int streamId)
+	{
+		std::unique_lock<std::mutex> lock(streamMutex);
+
+		// Queued frames keep their stream alive until processed.
+		streams.erase(streamId);
+	}
+
+	bool AudioProcessingPool::submit(int streamId, const int16_t * src, size_t srcSize, int16_t * dst, size_t dstSize, size_t frames, int64_t tag)
+	{
+		std::shared_ptr<Stream> stream;
+
+		{
+			std::unique_lock<std::mutex> lock(streamMutex);
+
+			auto it = streams.find(streamId);
+
+			if (it == streams.end()) {
+				throw Exception("AudioProcessingPool: Unknown stream %d", streamId);
+			}
+
+			stream = it->second;
+		}
+
+		if (srcSize < stream->inputConfig.num_samples() * frames || dstSize < stream->outputConfig.num_samples() * frames) {
+			throw Exception("AudioProcessingPool: Buffers too small for %zu frames", frames);
+		}
+
+		Worker * worker = workers[static_cast<size_t>(streamId) % workers.size()].get();
+
+		if (!worker->tasks.push(Task{ stream, src, dst, frames, tag })) {
+			return false;
+		}
+
+		if (worker->idle.load(std::memory_order_acquire)) {
+			std::unique_lock<std::mutex> lock(worker->mutex);
+
+			worker->condition.notify_one();
+		}
+
+		return true;
+	}
+
+	bool AudioProcessingPool::poll(Completion & completion)
+	{
+		if (!completions.pop(completion)) {
+			return false;
+		}
+
+		if (completionWaiters.load() > 0) {
+			std::unique_lock<std::mutex> lock(completionMutex);
+
+			completionsTaken++;
+			completionCondition.notify_all();
+		}
+
+		return true;
+	}
+
+	void AudioProcessingPool::run(Worker * worker)
+	{
+		Task task;
+
+		while (running) {
+			if (!worker->tasks.pop(task)) {
+				std::unique_lock<std::mutex> lock(worker->mutex);
+
+				worker->idle.store(true, std::memory_order_release);
+
+				// The timeout only guards against missed wake-ups.
+				worker->condition.wait_for(lock, std::chrono::milliseconds(10), [this, worker] {
+					return !running || !worker->tasks.empty();
+				});
+
+				worker->idle.store(false, std::memory_order_release);
+				continue;
+			}
+
+			const Stream & stream = *task.stream;
+
+			int result = AudioProcessing::process(stream.apm.get(), task.src, stream.inputConfig,
+				stream.outputConfig, task.dst, task.frames, false);
+
+			Completion completion{ task.tag, stream.id, result };
+
+			// Back-pressure if results are not collected.
+			while (!completions.push(std::move(completion))) {
+				std::unique_lock<std::mutex> lock(completionMutex);
+
+				const uint64_t taken = completionsTaken;
+
+				completionWaiters++;
+
+				// The timeout only guards against missed wake-ups.
+				completionCondition.wait_for(lock, std::chrono::milliseconds(10), [this, taken] {
+					return !running || completionsTaken != taken;
+				});
+
+				completionWaiters--;
+
+				if (!running) {
+					return;
+				}
+			}
+
+			task.stream.reset();
+		}
+	}
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/AudioResampler.h"
+
+namespace jni
+{
+	AudioResampler::AudioResampler() :
+		sourceRate(0),
+		targetRate(0),
+		channels(0)
+	{
+	}
+
+	void AudioResampler::reset(int sourceRate, int targetRate, int channels)
+	{
+		this->sourceRate = sourceRate;
+		this->targetRate = targetRate;
+		this->channels = channels;
+
+		resampler16.InitializeIfNeeded(sourceRate, targetRate, channels);
+	}
+
+	int AudioResampler::resample(const int16_t * src, size_t srcSamples, int16_t * dst, size_t dstSamples)
+	{
+		return resample(resampler16, src, srcSamples, dst, dstSamples);
+	}
+
+	int AudioResampler::resample(const float * src, size_t srcSamples, float * dst, size_t dstSamples)
+	{
+		// The float resampler is only set up when used.
+		if (resamplerFloat.InitializeIfNeeded(sourceRate, targetRate, channels) != 0) {
+			return -1;
+		}
+
+		return resample(resamplerFloat, src, srcSamples, dst, dstSamples);
+	}
+
+	template <typename T>
+	int AudioResampler::resample(webrtc::PushResampler<T> & resampler, const T * src, size_t srcSamples, T * dst, size_t dstSamples)
+	{
+		const size_t srcBlockSize = static_cast<size_t>(sourceRate / 100 * channels);
+		const size_t dstBlockSize = static_cast<size_t>(targetRate / 100 * channels);
+
+		if (srcBlockSize == 0 || dstBlockSize == 0 || srcSamples == 0 || srcSamples % srcBlockSize != 0) {
+			return -1;
+		}
+
+		const size_t blocks = srcSamples / srcBlockSize;
+
+		if (blocks * dstBlockSize > dstSamples) {
+			return -1;
+		}
+
+		size_t written = 0;
+
+		for (size_t i = 0; i < blocks; ++i) {
+			int result = resampler.Resample(src + i * srcBlockSize, srcBlockSize, dst + written, dstSamples - written);
+
+			if (result < 0) {
+				return result;
+			}
+
+			written += static_cast<size_t>(result);
+		}
+
+		return static_cast<int>(written);
+	}
+}
@@ -0,0 +1,260 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/OggOpusFileWriter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <random>
+
+namespace jni
+{
+	static const uint8_t kHeaderTypeContinued = 0x01;
+	static const uint8_t kHeaderTypeBos = 0x02;
+	static const uint8_t kHeaderTypeEos = 0x04;
+
+	static const uint32_t kOpusSampleRate = 48000;
+
+	// Encoder delay of libopus at 48 kHz, the received stream does not signal it.
+	static const uint16_t kOpusPreSkip = 312;
+
+	// Granule position of pages on which no packet ends.
+	static const uint64_t kNoGranule = ~static_cast<uint64_t>(0);
+
+	static const size_t kMaxPageSegments = 255;
+
+	static const char kVendor[] = "webrtc-java";
+
+	static uint32_t crcTable[256];
+
+	static void initCrcTable()
+	{
+		// Ogg uses the non-reflected CRC-32 with polynomial 0x04c11db7.
+		for (uint32_t i = 0; i < 256; ++i) {
+			uint32_t r = i << 24;
+
+			for (int j = 0; j < 8; ++j) {
+				r = (r & 0x80000000) ? (r << 1) ^ 0x04c11db7 : (r << 1);
+			}
+
+			crcTable[i] = r;
+		}
+	}
+
+	static uint32_t crc32(const uint8_t * data, size_t size)
+	{
+		uint32_t crc = 0;
+
+		for (size_t i = 0; i < size; ++i) {
+			crc = (crc << 8) ^ crcTable[((crc >> 24) & 0xff) ^ data[i]];
+		}
+
+		return crc;
+	}
+
+	static void writeLE16(uint8_t * dst, uint16_t value)
+	{
+		dst[0] = static_cast<uint8_t>(value);
+		dst[1] = static_cast<uint8_t>(value >> 8);
+	}
+
+	static void writeLE32(uint8_t * dst, uint32_t value)
+	{
+		for (int i = 0; i < 4; ++i) {
+			dst[i] = static_cast<uint8_t>(value >> (i * 8));
+		}
+	}
+
+	static void writeLE64(uint8_t * dst, uint64_t value)
+	{
+		for (int i = 0; i < 8; ++i) {
+			dst[i] = static_cast<uint8_t>(value >> (i * 8));
+		}
+	}
+
+	// Number of samples at 48 kHz contained in an Opus packet (RFC 6716, section 3.1).
+	static uint32_t getOpusSamples(const uint8_t * data, size_t size)
+	{
+		if (size < 1) {
+			return 0;
+		}
+
+		uint8_t toc = data[0];
+		uint8_t config = toc >> 3;
+		uint32_t frameSamples;
+
+		if (config < 12) {
+			// SILK-only: 10, 20, 40, 60 ms.
+			static const uint32_t sizes[] = { 480, 960, 1920, 2880 };
+			frameSamples = sizes[config & 0x03];
+		}
+		else if (config < 16) {
+			// Hybrid: 10, 20 ms.
+			frameSamples = (config & 0x01) ? 960 : 480;
+		}
+		else {
+			// CELT-only: 2.5, 5, 10, 20 ms.
+			frameSamples = 120 << (config & 0x03);
+		}
+
+		uint32_t frames;
+
+		switch (toc & 0x03) {
+			case 0:
+				frames = 1;
+				break;
+
+			case 1:
+			case 2:
+				frames = 2;
+				break;
+
+			default:
+				frames = (size < 2) ? 0 : (data[1] & 0x3F);
+				break;
+		}
+
+		return frameSamples * frames;
+	}
+
+	OggOpusFileWriter::OggOpusFileWriter(const std::string & fileName, uint8_t channels) :
+		writer(fileName),
+		serial(std::random_device()()),
+		sequence(0),
+		packetGranule(0),
+		hasPacket(false),
+		started(false),
+		lastRtpTimestamp(0),
+		timestamp(0),
+		closed(false)
+	{
+		static std::once_flag crcFlag;
+		std::call_once(crcFlag, initCrcTable);
+
+		uint8_t head[19];
+		std::memcpy(&head[0], "OpusHead", 8);
+		head[8] = 1;					// Version
+		head[9] = channels;
+		writeLE16(&head[10], kOpusPreSkip);
+		writeLE32(&head[12], kOpusSampleRate);
+		writeLE16(&head[16], 0);		// Output gain
+		head[18] = 0;					// Channel mapping family
+
+		writePage(head, sizeof(head), 0, kHeaderTypeBos);
+
+		const uint32_t vendorLength = sizeof(kVendor) - 1;
+
+		std::vector<uint8_t> tags(8 + 4 + vendorLength + 4);
+		std::memcpy(&tags[0], "OpusTags", 8);
+		writeLE32(&tags[8], vendorLength);
+		std::memcpy(&tags[12], kVendor, vendorLength);
+		writeLE32(&tags[12 + vendorLength], 0);
+
+		writePage(tags.data(), tags.size(), 0, 0);
+	}
+
+	OggOpusFileWriter::~OggOpusFileWriter()
+	{
+		close();
+	}
+
+	void OggOpusFileWriter::writePacket(const uint8_t * data, size_t size, uint32_t rtpTimestamp)
+	{
+		if (!started) {
+			started = true;
+			lastRtpTimestamp = rtpTimestamp;
+		}
+
+		// Unwrap the 32-bit RTP timestamp, the Opus RTP clock rate is always 48 kHz.
+		timestamp += static_cast<int32_t>(rtpTimestamp - lastRtpTimestamp);
+		lastRtpTimestamp = rtpTimestamp;
+
+		flushPacket(false);
+
+		packet.assign(data, data + size);
+		packetGranule = static_cast<uint64_t>(std::max<int64_t>(timestamp, 0)) + getOpusSamples(data, size);
+		hasPacket = true;
+	}
+
+	void OggOpusFileWriter::close()
+	{
+		if (closed) {
+			return;
+		}
+
+		closed = true;
+
+		flushPacket(true);
+
+		writer.close();
+	}
+
+	void OggOpusFileWriter::flushPacket(bool last)
+	{
+		if (!hasPacket) {
+			return;
+		}
+
+		writePage(packet.data(), packet.size(), packetGranule, last ? kHeaderTypeEos : 0);
+
+		hasPacket = false;
+	}
+
+	void OggOpusFileWriter::writePage(const uint8_t * data, size_t size, uint64_t granule, uint8_t flags)
+	{
+		// A packet takes size / 255 + 1 lacing values, the last one below 255. Packets
+		// exceeding the 255 lacing values of a page are continued on the next pages.
+		size_t lacing = size / 255 + 1;
+		bool continued = false;
+
+		do {
+			const size_t segments = std::min(lacing, kMaxPageSegments);
+			const bool packetEnds = segments == lacing;
+			const size_t pageSize = packetEnds ? size : segments * 255;
+
+			page.resize(27 + segments + pageSize);
+
+			uint8_t * header = page.data();
+			std::memcpy(&header[0], "OggS", 4);
+			header[4] = 0;					// Version
+			header[5] = (continued ? kHeaderTypeContinued : 0) |
+				(packetEnds ? flags : (flags & kHeaderTypeBos));
+			writeLE64(&header[6], packetEnds ? granule : kNoGranule);
+			writeLE32(&header[14], serial);
+			writeLE32(&header[18], sequence++);
+			writeLE32(&header[22], 0);		// CRC, computed below
+			header[26] = static_cast<uint8_t>(segments);
+
+			for (size_t i = 0; i < segments; ++i) {
+				header[27 + i] = (i < segments - 1 || !packetEnds) ? 255 : static_cast<uint8_t>(size % 255);
+			}
+
+			std::memcpy(&header[27 + segments], data, pageSize);
+
+			writeLE32(&header[22], crc32(page.data(), page.size()));
+
+			writer.write(page.data(), page.size());
+
+			data += pageSize;
+			size -= pageSize;
+			lacing -= segments;
+			continued = true;
+			flags &= ~kHeaderTypeBos;
+		}
+		while (lacing > 0);
+	}
+}
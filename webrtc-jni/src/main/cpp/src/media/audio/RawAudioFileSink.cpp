@@ -16,19 +16,16 @@
 
 #include "media/audio/RawAudioFileSink.h"
 
-#include <iostream>
-
 namespace jni
 {
-	RawAudioFileSink::RawAudioFileSink(std::string fileName)
+	RawAudioFileSink::RawAudioFileSink(std::string fileName) :
+		writer(fileName)
 	{
-		outputStream.open(fileName, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
 	}
 
 	RawAudioFileSink::~RawAudioFileSink()
 	{
-		outputStream.flush();
-		outputStream.close();
+		writer.close();
 	}
 
 	int32_t RawAudioFileSink::RecordedDataIsAvailable(
@@ -43,9 +40,7 @@ namespace jni
 		const bool keyPressed,
 		uint32_t & newMicLevel)
 	{
-		size_t audioSamplesSize = nSamples * nBytesPerSample;
-
-		outputStream.write(static_cast<const char *>(audioSamples), audioSamplesSize);
+		writer.write(audioSamples, nSamples * nBytesPerSample);
 
 		return 0;
 	}
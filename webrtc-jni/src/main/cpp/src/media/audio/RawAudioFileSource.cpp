@@ -21,20 +21,17 @@
 
 namespace jni
 {
-	RawAudioFileSource::RawAudioFileSource(std::string fileName)
+	RawAudioFileSource::RawAudioFileSource(std::string fileName, bool loop) :
+		file(MappedFile::open(fileName)),
+		position(0),
+		loop(loop)
 	{
-		inputStream.open(fileName, std::ofstream::in | std::ofstream::binary);
-
-		// Get length of the file.
-		inputStream.seekg(0, inputStream.end);
-		fileLength = inputStream.tellg();
-		fileRemainingBytes = fileLength;
-		inputStream.seekg(0, inputStream.beg);
+		// Page in the file before playout starts to not block the audio thread on disk I/O.
+		file->prefetch();
 	}
 
 	RawAudioFileSource::~RawAudioFileSource()
 	{
-		inputStream.close();
 	}
 
 	int32_t RawAudioFileSource::NeedMorePlayData(
@@ -47,26 +44,39 @@ namespace jni
 		int64_t * elapsed_time_ms,
 		int64_t * ntp_time_ms)
 	{
+		uint8_t * dst = static_cast<uint8_t *>(audioSamples);
 		size_t audioSamplesSize = nSamples * nBytesPerSample;
-		size_t readBytes = std::min(audioSamplesSize, fileRemainingBytes);
+		// Play whole samples only.
+		size_t fileLength = file->size() - file->size() % nBytesPerSample;
+		size_t copied = 0;
 
 		*elapsed_time_ms = 0;
 		*ntp_time_ms = 0;
 
-		if (readBytes < nBytesPerSample) {
-			// EOF. Fill with silence.
-			nSamplesOut = nSamples;
+		while (copied < audioSamplesSize) {
+			if (position >= fileLength) {
+				if (!loop || fileLength == 0) {
+					break;
+				}
+
+				position = 0;
+			}
 
-			std::memset(audioSamples, 0, audioSamplesSize);
+			size_t length = std::min(audioSamplesSize - copied, fileLength - position);
 
-			return 0;
+			std::memcpy(dst + copied, file->data() + position, length);
+
+			position += length;
+			copied += length;
 		}
 
-		nSamplesOut = readBytes / nBytesPerSample;
-		fileRemainingBytes -= readBytes;
+		if (copied < audioSamplesSize) {
+			// EOF. Fill with silence.
+			std::memset(dst + copied, 0, audioSamplesSize - copied);
+		}
 
-		inputStream.read(static_cast<char *>(audioSamples), readBytes);
+		nSamplesOut = nSamples;
 
 		return 0;
 	}
-}
\ No newline at end of file
+}
@@ -16,15 +16,59 @@
 
 #include "media/audio/WavAudioFileSink.h"
 
+#include "rtc_base/logging.h"
+
+#include <cstring>
+
 namespace jni
 {
-	WavAudioFileSink::WavAudioFileSink(std::string fileName)
+	static const size_t kWavHeaderSize = 44;
+
+	static void writeLE16(uint8_t * dst, uint16_t value)
+	{
+		dst[0] = static_cast<uint8_t>(value);
+		dst[1] = static_cast<uint8_t>(value >> 8);
+	}
+
+	static void writeLE32(uint8_t * dst, uint32_t value)
 	{
-		wavWriter = std::make_unique<webrtc::WavWriter>(fileName, 48000, 2);
+		for (int i = 0; i < 4; ++i) {
+			dst[i] = static_cast<uint8_t>(value >> (i * 8));
+		}
+	}
+
+	WavAudioFileSink::WavAudioFileSink(std::string fileName) :
+		fileName(fileName),
+		sampleRate(0),
+		channels(0),
+		dataSize(0),
+		closed(false)
+	{
+		// Open the file here and not in the audio callback. The header is a placeholder
+		// until the file is closed, the audio format is only known with the first frame.
+		writer = std::make_unique<AsyncFileWriter>(fileName);
+
+		writeHeader(false);
 	}
 
 	WavAudioFileSink::~WavAudioFileSink()
 	{
+		close();
+	}
+
+	void WavAudioFileSink::close()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		if (closed) {
+			return;
+		}
+
+		closed = true;
+
+		writeHeader(true);
+
+		writer->close();
 	}
 
 	int32_t WavAudioFileSink::RecordedDataIsAvailable(
@@ -39,8 +83,89 @@ namespace jni
 		const bool keyPressed,
 		uint32_t & newMicLevel)
 	{
-		wavWriter->WriteSamples(static_cast<const int16_t *>(audioSamples), nSamples * nChannels);
+		write(static_cast<const int16_t *>(audioSamples), nSamples, nChannels, samplesPerSec);
 
 		return 0;
 	}
-}
\ No newline at end of file
+
+	void WavAudioFileSink::OnData(const void * data, int bitsPerSample, int sampleRate, size_t channels, size_t frames)
+	{
+		if (bitsPerSample != 16) {
+			return;
+		}
+
+		write(static_cast<const int16_t *>(data), frames, channels, static_cast<uint32_t>(sampleRate));
+	}
+
+	void WavAudioFileSink::write(const int16_t * samples, size_t frames, size_t channels, uint32_t sampleRate)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		if (closed || frames == 0 || channels == 0) {
+			return;
+		}
+
+		if (this->sampleRate == 0) {
+			this->sampleRate = sampleRate;
+			this->channels = channels;
+		}
+
+		if (sampleRate == this->sampleRate && channels == this->channels) {
+			size_t size = frames * channels * sizeof(int16_t);
+
+			writer->write(samples, size);
+
+			dataSize += size;
+			return;
+		}
+
+		// The converter operates on 10 ms frames.
+		if (frames * 100 != sampleRate) {
+			RTC_LOG(LS_WARNING) << "WAV sink: Drop audio frame with " << frames << " samples at " << sampleRate << " Hz";
+			return;
+		}
+
+		size_t dstFrames = this->sampleRate / 100;
+
+		if (!converter || converter->getSrcFrames() != frames || converter->getSrcChannels() != channels) {
+			converter = AudioConverter::create(frames, channels, dstFrames, this->channels);
+			buffer.resize(dstFrames * this->channels);
+		}
+
+		converter->convert(samples, frames * channels, buffer.data(), buffer.size());
+
+		size_t size = buffer.size() * sizeof(int16_t);
+
+		writer->write(buffer.data(), size);
+
+		dataSize += size;
+	}
+
+	void WavAudioFileSink::writeHeader(bool finalize)
+	{
+		uint8_t header[kWavHeaderSize];
+		uint16_t blockAlign = static_cast<uint16_t>(channels * sizeof(int16_t));
+		uint32_t dataLength = static_cast<uint32_t>(dataSize);
+
+		std::memcpy(&header[0], "RIFF", 4);
+		writeLE32(&header[4], static_cast<uint32_t>(kWavHeaderSize - 8 + dataLength));
+		std::memcpy(&header[8], "WAVE", 4);
+		std::memcpy(&header[12], "fmt ", 4);
+		writeLE32(&header[16], 16);
+		writeLE16(&header[20], 1);		// PCM
+		writeLE16(&header[22], static_cast<uint16_t>(channels));
+		writeLE32(&header[24], sampleRate);
+		writeLE32(&header[28], sampleRate * blockAlign);
+		writeLE16(&header[32], blockAlign);
+		writeLE16(&header[34], 16);
+		std::memcpy(&header[36], "data", 4);
+		writeLE32(&header[40], dataLength);
+
+		if (finalize) {
+			writer->writeAt(0, header, sizeof(header));
+		}
+		else {
+			writer->write(header, sizeof(header));
+		}
+	}
+}
@@ -15,22 +15,41 @@
  */
 
 #include "media/audio/WavAudioFileSource.h"
+#include "media/audio/AudioConverter.h"
+#include "Exception.h"
 
+#include "common_audio/wav_file.h"
 #include "rtc_base/logging.h"
 
 #include <algorithm>
 #include <cstring>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 namespace jni
 {
-	WavAudioFileSource::WavAudioFileSource(std::string fileName)
-	{
-		wavReader = std::make_unique<webrtc::WavReader>(fileName);
+	using CacheKey = std::tuple<std::string, uint32_t, size_t>;
+	using Samples = std::shared_ptr<const std::vector<int16_t>>;
 
-		RTC_LOG(LS_INFO) << "WAV file opened:"
-			<< " Sample Rate: " << wavReader->sample_rate()
-			<< ", Channels: " << wavReader->num_channels()
-			<< ", Samples: " << wavReader->num_samples();
+	static std::mutex cacheMutex;
+	static std::map<CacheKey, std::weak_ptr<const std::vector<int16_t>>> cache;
+	// Files being loaded, sources of the same file and format wait for the result.
+	static std::map<CacheKey, std::shared_future<Samples>> loading;
+
+	static Samples decode(const std::string & fileName, uint32_t sampleRate, size_t channels);
+
+	WavAudioFileSource::WavAudioFileSource(std::string fileName, uint32_t sampleRate, size_t channels, bool loop) :
+		samples(load(fileName, sampleRate, channels)),
+		position(0),
+		sampleRate(sampleRate),
+		channels(channels),
+		loop(loop),
+		formatMismatch(false)
+	{
 	}
 
 	WavAudioFileSource::~WavAudioFileSource()
@@ -47,18 +66,169 @@ namespace jni
 		int64_t * elapsed_time_ms,
 		int64_t * ntp_time_ms)
 	{
+		int16_t * dst = static_cast<int16_t *>(audioSamples);
+		size_t dstLength = nSamples * nChannels;
+		size_t length = samples->size();
+		size_t copied = 0;
+
 		*elapsed_time_ms = 0;
 		*ntp_time_ms = 0;
 
-		nSamplesOut = wavReader->ReadSamples(nSamples * nChannels, static_cast<int16_t *>(audioSamples));
+		nSamplesOut = nSamples;
 
-		if (nSamplesOut < nSamples) {
-			// EOF. Fill with silence.
-			nSamplesOut = nSamples * nChannels;
+		if (samplesPerSec != sampleRate || nChannels != channels) {
+			if (!formatMismatch) {
+				formatMismatch = true;
+
+				RTC_LOG(LS_WARNING) << "WAV source: Playout format " << samplesPerSec << " Hz, " << nChannels
+					<< " channels does not match the source format " << sampleRate << " Hz, " << channels << " channels";
+			}
 
-			std::memset(audioSamples, 0, nSamples * nBytesPerSample);
+			std::memset(dst, 0, nSamples * nBytesPerSample);
+			return 0;
+		}
+
+		while (copied < dstLength) {
+			if (position >= length) {
+				if (!loop || length == 0) {
+					break;
+				}
+
+				position = 0;
+			}
+
+			size_t count = std::min(dstLength - copied, length - position);
+
+			std::memcpy(dst + copied, samples->data() + position, count * sizeof(int16_t));
+
+			position += count;
+			copied += count;
+		}
+
+		if (copied < dstLength) {
+			// EOF. Fill with silence.
+			std::memset(dst + copied, 0, (dstLength - copied) * sizeof(int16_t));
 		}
 
 		return 0;
 	}
-}
\ No newline at end of file
+
+	std::shared_ptr<const std::vector<int16_t>> WavAudioFileSource::load(const std::string & fileName, uint32_t sampleRate, size_t channels)
+	{
+		CacheKey key(fileName, sampleRate, channels);
+		std::promise<Samples> promise;
+
+		{
+			std::unique_lock<std::mutex> lock(cacheMutex);
+
+			auto cached = cache.find(key);
+
+			if (cached != cache.end()) {
+				if (Samples samples = cached->second.lock()) {
+					return samples;
+				}
+			}
+
+			auto pending = loading.find(key);
+
+			if (pending != loading.end()) {
+				std::shared_future<Samples> future = pending->second;
+
+				lock.unlock();
+
+				// Rethrows the exception of a failed load.
+				return future.get();
+			}
+
+			loading.emplace(key, promise.get_future().share());
+		}
+
+		// Read and convert the file without holding the lock, other files load in parallel.
+		Samples samples;
+
+		try {
+			samples = decode(fileName, sampleRate, channels);
+		}
+		catch (...) {
+			{
+				std::unique_lock<std::mutex> lock(cacheMutex);
+
+				loading.erase(key);
+			}
+
+			promise.set_exception(std::current_exception());
+			throw;
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(cacheMutex);
+
+			cache[key] = samples;
+			loading.erase(key);
+
+			// Drop entries of files that are no longer used.
+			for (auto it = cache.begin(); it != cache.end();) {
+				it = it->second.expired() ? cache.erase(it) : std::next(it);
+			}
+		}
+
+		promise.set_value(samples);
+
+		return samples;
+	}
+
+	static Samples decode(const std::string & fileName, uint32_t sampleRate, size_t channels)
+	{
+		if (sampleRate % 100 != 0 || channels == 0) {
+			throw Exception("WAV source: Unsupported playout format %u Hz, %zu channels", sampleRate, channels);
+		}
+
+		// WavReader does not report errors, it crashes on files it cannot open.
+		if (!std::ifstream(fileName).good()) {
+			throw Exception("Open file %s failed", fileName.c_str());
+		}
+
+		webrtc::WavReader reader(fileName);
+
+		uint32_t srcRate = static_cast<uint32_t>(reader.sample_rate());
+		size_t srcChannels = reader.num_channels();
+
+		RTC_LOG(LS_INFO) << "WAV file opened:"
+			<< " Sample Rate: " << srcRate
+			<< ", Channels: " << srcChannels
+			<< ", Samples: " << reader.num_samples();
+
+		std::vector<int16_t> input(reader.num_samples());
+		input.resize(reader.ReadSamples(input.size(), input.data()));
+
+		auto output = std::make_shared<std::vector<int16_t>>();
+
+		if (srcRate == sampleRate && srcChannels == channels) {
+			output->swap(input);
+		}
+		else {
+			if (srcRate % 100 != 0) {
+				throw Exception("WAV source: Unsupported sample rate %u Hz of %s", srcRate, fileName.c_str());
+			}
+
+			// The converter operates on 10 ms frames.
+			size_t srcFrames = srcRate / 100;
+			size_t dstFrames = sampleRate / 100;
+			size_t srcSize = srcFrames * srcChannels;
+			size_t dstSize = dstFrames * channels;
+			size_t blocks = (input.size() + srcSize - 1) / srcSize;
+
+			// Pad the last block with silence.
+			input.resize(blocks * srcSize, 0);
+			output->resize(blocks * dstSize);
+
+			std::unique_ptr<AudioConverter> converter = AudioConverter::create(srcFrames, srcChannels, dstFrames, channels);
+
+			for (size_t i = 0; i < blocks; ++i) {
+				converter->convert(input.data() + i * srcSize, srcSize, output->data() + i * dstSize, dstSize);
+			}
+		}
+
+		return output;
+	}
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/video/I420BufferPool.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace jni
+{
+	static size_t GetBufferSize(const webrtc::I420Buffer & buffer)
+	{
+		return static_cast<size_t>(buffer.StrideY()) * buffer.height() +
+			static_cast<size_t>(buffer.StrideU() + buffer.StrideV()) * buffer.ChromaHeight();
+	}
+
+	// Buffer allocated while all pooled buffers are in use, counted until it is deleted.
+	class UnpooledI420Buffer : public webrtc::I420Buffer
+	{
+		public:
+			UnpooledI420Buffer(int width, int height, std::atomic<size_t> & buffers, std::atomic<size_t> & bytes) :
+				webrtc::I420Buffer(width, height),
+				buffers(buffers),
+				bytes(bytes),
+				size(GetBufferSize(*this))
+			{
+				buffers.fetch_add(1, std::memory_order_relaxed);
+				bytes.fetch_add(size, std::memory_order_relaxed);
+			}
+
+		protected:
+			~UnpooledI420Buffer() override
+			{
+				buffers.fetch_sub(1, std::memory_order_relaxed);
+				bytes.fetch_sub(size, std::memory_order_relaxed);
+			}
+
+		private:
+			std::atomic<size_t> & buffers;
+			std::atomic<size_t> & bytes;
+			const size_t size;
+	};
+
+	I420BufferPool::I420BufferPool(size_t maxBuffers) :
+		maxBuffers(maxBuffers),
+		useCounter(0),
+		unpooledBuffers(0),
+		unpooledBytes(0)
+	{
+	}
+
+	I420BufferPool & I420BufferPool::shared()
+	{
+		static I420BufferPool pool;
+
+		return pool;
+	}
+
+	rtc::scoped_refptr<webrtc::I420Buffer> I420BufferPool::create(int width, int height)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+
+			const uint64_t key = (static_cast<uint64_t>(width) << 32) | static_cast<uint32_t>(height);
+
+			auto it = pools.find(key);
+
+			if (it == pools.end()) {
+				if (pools.size() >= kMaxResolutions) {
+					// Drop the least recently used resolution, buffers still in use stay valid.
+					auto lru = std::min_element(pools.begin(), pools.end(), [](const auto & a, const auto & b) {
+						return a.second.lastUse < b.second.lastUse;
+					});
+
+					pools.erase(lru);
+				}
+
+				it = pools.emplace(key, Entry()).first;
+			}
+
+			Entry & entry = it->second;
+			entry.lastUse = ++useCounter;
+
+			// Buffers in use when the pool was shrunk are dropped once released.
+			dropFreeBuffers(entry, maxBuffers);
+
+			for (const auto & buffer : entry.buffers) {
+				if (buffer->HasOneRef()) {
+					return buffer;
+				}
+			}
+
+			if (entry.buffers.size() < maxBuffers) {
+				rtc::scoped_refptr<PooledBuffer> buffer = new PooledBuffer(width, height);
+
+				entry.buffers.push_back(buffer);
+
+				return buffer;
+			}
+		}
+
+		return new rtc::RefCountedObject<UnpooledI420Buffer>(width, height, unpooledBuffers, unpooledBytes);
+	}
+
+	void I420BufferPool::setMaxBuffers(size_t maxBuffers)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		this->maxBuffers = maxBuffers;
+
+		for (auto & entry : pools) {
+			dropFreeBuffers(entry.second, maxBuffers);
+		}
+	}
+
+	size_t I420BufferPool::getMaxBuffers()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		return maxBuffers;
+	}
+
+	void I420BufferPool::release()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		for (auto it = pools.begin(); it != pools.end();) {
+			dropFreeBuffers(it->second, 0);
+
+			it = it->second.buffers.empty() ? pools.erase(it) : std::next(it);
+		}
+	}
+
+	I420BufferPool::Stats I420BufferPool::getStats()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		Stats stats = {};
+
+		for (const auto & entry : pools) {
+			for (const auto & buffer : entry.second.buffers) {
+				stats.buffers++;
+				stats.bytes += GetBufferSize(*buffer);
+			}
+		}
+
+		stats.buffers += unpooledBuffers.load(std::memory_order_relaxed);
+		stats.bytes += unpooledBytes.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	void I420BufferPool::dropFreeBuffers(Entry & entry, size_t maxBuffers)
+	{
+		auto & buffers = entry.buffers;
+
+		for (auto it = buffers.begin(); it != buffers.end() && buffers.size() > maxBuffers;) {
+			// Only the pool references free buffers, no other thread can take them meanwhile.
+			it = (*it)->HasOneRef() ? buffers.erase(it) : std::next(it);
+		}
+	}
+}
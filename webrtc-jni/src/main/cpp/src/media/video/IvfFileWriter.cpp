@@ -0,0 +1,153 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/video/IvfFileWriter.h"
+#include "Exception.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace jni
+{
+	static void writeLE16(uint8_t * dst, uint16_t value)
+	{
+		dst[0] = static_cast<uint8_t>(value);
+		dst[1] = static_cast<uint8_t>(value >> 8);
+	}
+
+	static void writeLE32(uint8_t * dst, uint32_t value)
+	{
+		for (int i = 0; i < 4; ++i) {
+			dst[i] = static_cast<uint8_t>(value >> (i * 8));
+		}
+	}
+
+	static void writeLE64(uint8_t * dst, uint64_t value)
+	{
+		for (int i = 0; i < 8; ++i) {
+			dst[i] = static_cast<uint8_t>(value >> (i * 8));
+		}
+	}
+
+	static uint32_t toFourCC(const std::string & codecName)
+	{
+		const char * fourCC = nullptr;
+
+		if (codecName == "VP8") {
+			fourCC = "VP80";
+		}
+		else if (codecName == "VP9") {
+			fourCC = "VP90";
+		}
+		else if (codecName == "AV1" || codecName == "AV1X") {
+			fourCC = "AV01";
+		}
+		else if (codecName == "H264") {
+			fourCC = "H264";
+		}
+		else {
+			throw Exception("IVF: Unsupported codec %s", codecName.c_str());
+		}
+
+		uint32_t value;
+		std::memcpy(&value, fourCC, 4);
+
+		return value;
+	}
+
+	IvfFileWriter::IvfFileWriter(const std::string & fileName, const std::string & codecName) :
+		fourCC(toFourCC(codecName)),
+		writer(fileName),
+		width(0),
+		height(0),
+		frameCount(0),
+		started(false),
+		lastRtpTimestamp(0),
+		timestamp(0),
+		closed(false)
+	{
+		writeHeader(false);
+	}
+
+	IvfFileWriter::~IvfFileWriter()
+	{
+		close();
+	}
+
+	void IvfFileWriter::writeFrame(const uint8_t * data, size_t size, uint32_t rtpTimestamp, bool keyFrame, uint16_t width, uint16_t height)
+	{
+		if (!started) {
+			// The first frame in the file must be decodable on its own.
+			if (!keyFrame) {
+				return;
+			}
+
+			started = true;
+			lastRtpTimestamp = rtpTimestamp;
+		}
+
+		// Unwrap the 32-bit RTP timestamp.
+		timestamp += static_cast<int32_t>(rtpTimestamp - lastRtpTimestamp);
+		lastRtpTimestamp = rtpTimestamp;
+
+		this->width = std::max(this->width, width);
+		this->height = std::max(this->height, height);
+
+		uint8_t frameHeader[12];
+		writeLE32(&frameHeader[0], static_cast<uint32_t>(size));
+		writeLE64(&frameHeader[4], static_cast<uint64_t>(std::max<int64_t>(timestamp, 0)));
+
+		writer.write(frameHeader, sizeof(frameHeader));
+		writer.write(data, size);
+
+		frameCount++;
+	}
+
+	void IvfFileWriter::close()
+	{
+		if (closed) {
+			return;
+		}
+
+		closed = true;
+
+		writeHeader(true);
+
+		writer.close();
+	}
+
+	void IvfFileWriter::writeHeader(bool finalize)
+	{
+		uint8_t header[32] = { 0 };
+
+		std::memcpy(&header[0], "DKIF", 4);
+		writeLE16(&header[4], 0);		// Version
+		writeLE16(&header[6], 32);		// Header size
+		std::memcpy(&header[8], &fourCC, 4);
+		writeLE16(&header[12], width);
+		writeLE16(&header[14], height);
+		writeLE32(&header[16], kTimebase);
+		writeLE32(&header[20], 1);
+		writeLE32(&header[24], frameCount);
+
+		if (finalize) {
+			writer.writeAt(0, header, sizeof(header));
+		}
+		else {
+			writer.write(header, sizeof(header));
+		}
+	}
+}
@@ -16,26 +16,40 @@
 
 #include "media/video/RawVideoFileSink.h"
 
+#include "common_video/libyuv/include/webrtc_libyuv.h"
 #include "rtc_base/logging.h"
 
 namespace jni
 {
-	RawVideoFileSink::RawVideoFileSink(std::string fileName)
+	RawVideoFileSink::RawVideoFileSink(std::string fileName) :
+		writer(fileName)
 	{
-		outputStream.open(fileName, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
 	}
 
 	RawVideoFileSink::~RawVideoFileSink()
 	{
-		outputStream.flush();
-		outputStream.close();
+		writer.close();
 	}
 
 	void RawVideoFileSink::OnFrame(const webrtc::VideoFrame & frame)
 	{
-		RTC_LOG(LS_INFO) << "VideoFrame: " << frame.width() << "x" << frame.height() << " timestamp: " << frame.timestamp_us();
+		rtc::scoped_refptr<webrtc::I420BufferInterface> i420 = frame.video_frame_buffer()->ToI420();
 
-		//frame.video_frame_buffer()->ToI420();
+		if (!i420) {
+			return;
+		}
+
+		// Pack the planes without stride padding and hand them over to the writer thread.
+		size_t size = webrtc::CalcBufferSize(webrtc::VideoType::kI420, i420->width(), i420->height());
+
+		buffer.resize(size);
+
+		if (webrtc::ExtractBuffer(i420, size, buffer.data()) < 0) {
+			RTC_LOG(LS_ERROR) << "Extract I420 frame buffer failed";
+			return;
+		}
+
+		writer.write(buffer.data(), size);
 	}
 
 	void RawVideoFileSink::OnDiscardedFrame()
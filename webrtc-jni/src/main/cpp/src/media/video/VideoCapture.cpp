@@ -47,6 +47,11 @@ namespace jni
 
 	void VideoCapture::setVideoSink(std::unique_ptr<rtc::VideoSinkInterface<webrtc::VideoFrame>> sink)
 	{
+		if (captureModule) {
+			// Frames are delivered under the module lock, the previous sink is not used after this call.
+			captureModule->RegisterCaptureDataCallback(sink.get());
+		}
+
 		this->sink = std::move(sink);
 	}
 
@@ -98,9 +103,13 @@ namespace jni
 			throw new Exception("Create VideoCaptureModule for UID %s failed", devUid.c_str());
 		}
 
-		captureModule->RegisterCaptureDataCallback(std::move(sink).release());
+		if (sink) {
+			captureModule->RegisterCaptureDataCallback(sink.get());
+		}
 
-		capability.videoType = webrtc::VideoType::kI420;
+		if (capability.videoType == webrtc::VideoType::kUnknown) {
+			capability.videoType = webrtc::VideoType::kI420;
+		}
 
 		if (captureModule->StartCapture(capability) != 0) {
 			destroy();
@@ -16,6 +16,8 @@
 
 #include "media/video/VideoCaptureCapability.h"
 #include "JavaClasses.h"
+#include "JavaEnums.h"
+#include "JavaObject.h"
 #include "JNI_WebRTC.h"
 
 namespace jni
@@ -24,19 +26,17 @@ namespace jni
 	{
 		bool VideoCaptureCapability::operator<(const VideoCaptureCapability & other) const
 		{
-			if (width > other.width) {
-				return true;
+			// Larger capabilities first. Capabilities that differ only by their format are distinct.
+			if (width != other.width) {
+				return width > other.width;
 			}
-			if (height > other.height) {
-				return true;
+			if (height != other.height) {
+				return height > other.height;
 			}
-			if (maxFPS > other.maxFPS) {
-				return true;
+			if (maxFPS != other.maxFPS) {
+				return maxFPS > other.maxFPS;
 			}
-			if (videoType > other.videoType) {
-                return true;
-            }
-            return false;
+			return videoType > other.videoType;
 		}
 	}
 
@@ -46,19 +46,47 @@ namespace jni
 		{
 			const auto javaClass = JavaClasses::get<JavaVideoCaptureCapabilityClass>(env);
 
+			JavaLocalRef<jobject> videoType = JavaEnums::toJava(env, capability.videoType);
+
 			jobject obj = env->NewObject(javaClass->cls, javaClass->ctor,
 				static_cast<jint>(capability.width),
 				static_cast<jint>(capability.height),
-				static_cast<jint>(capability.maxFPS));
+				static_cast<jint>(capability.maxFPS),
+				videoType.get());
 
 			return JavaLocalRef<jobject>(env, obj);
 		}
 
+		webrtc::VideoCaptureCapability toNative(JNIEnv * env, const JavaRef<jobject> & javaType)
+		{
+			const auto javaClass = JavaClasses::get<JavaVideoCaptureCapabilityClass>(env);
+
+			JavaObject obj(env, javaType);
+
+			webrtc::VideoCaptureCapability capability;
+			capability.width = obj.getInt<int32_t>(javaClass->width);
+			capability.height = obj.getInt<int32_t>(javaClass->height);
+			capability.maxFPS = obj.getInt<int32_t>(javaClass->frameRate);
+
+			JavaLocalRef<jobject> videoType = obj.getObject(javaClass->videoType);
+
+			if (videoType.get()) {
+				capability.videoType = JavaEnums::toNative<webrtc::VideoType>(env, videoType);
+			}
+
+			return capability;
+		}
+
 		JavaVideoCaptureCapabilityClass::JavaVideoCaptureCapabilityClass(JNIEnv * env)
 		{
 			cls = FindClass(env, PKG_VIDEO"VideoCaptureCapability");
 
-			ctor = GetMethod(env, cls, "<init>", "(III)V");
+			ctor = GetMethod(env, cls, "<init>", "(IIIL" PKG_VIDEO "VideoType;)V");
+
+			width = GetFieldID(env, cls, "width", "I");
+			height = GetFieldID(env, cls, "height", "I");
+			frameRate = GetFieldID(env, cls, "frameRate", "I");
+			videoType = GetFieldID(env, cls, "videoType", "L" PKG_VIDEO "VideoType;");
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/video/VideoDesktopSourceStats.h"
+#include "JavaClasses.h"
+#include "JNI_WebRTC.h"
+
+namespace jni
+{
+	namespace VideoDesktopSourceStats
+	{
+		JavaLocalRef<jobject> toJava(JNIEnv * env, const VideoTrackDesktopSource::Stats & stats)
+		{
+			const auto javaClass = JavaClasses::get<JavaVideoDesktopSourceStatsClass>(env);
+
+			jobject obj = env->NewObject(javaClass->cls, javaClass->ctor,
+				static_cast<jdouble>(stats.frameRate),
+				static_cast<jdouble>(stats.captureTimeMs),
+				static_cast<jlong>(stats.framesCaptured),
+				static_cast<jlong>(stats.framesSkipped));
+
+			return JavaLocalRef<jobject>(env, obj);
+		}
+
+		JavaVideoDesktopSourceStatsClass::JavaVideoDesktopSourceStatsClass(JNIEnv * env)
+		{
+			cls = FindClass(env, PKG_VIDEO"VideoDesktopSourceStats");
+
+			ctor = GetMethod(env, cls, "<init>", "(DDJJ)V");
+		}
+	}
+}
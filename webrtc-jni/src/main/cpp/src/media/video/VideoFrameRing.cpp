@@ -0,0 +1,126 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "media/video/VideoFrameRing.h"
+#include "media/video/I420BufferPool.h"
+#include "Exception.h"
+
+#include "libyuv/convert_from.h"
+#include "libyuv/planar_functions.h"
+#include "libyuv/scale.h"
+#include "rtc_base/time_utils.h"
+
+namespace jni
+{
+	VideoFrameRing::VideoFrameRing(JNIEnv * env, const JavaRef<jobjectArray> & slots, const JavaRef<jobject> & timestamps,
+		int width, int height, Format format) :
+		width(width),
+		height(height),
+		format(format),
+		timestampsRef(env, timestamps),
+		timestamps(nullptr),
+		frameCount(0)
+	{
+		const jsize count = env->GetArrayLength(slots);
+		const jlong requiredSize = static_cast<jlong>(frameSize(width, height));
+
+		for (jsize i = 0; i < count; ++i) {
+			JavaLocalRef<jobject> slot(env, env->GetObjectArrayElement(slots, i));
+
+			uint8_t * address = static_cast<uint8_t *>(env->GetDirectBufferAddress(slot));
+
+			if (!address || env->GetDirectBufferCapacity(slot) < requiredSize) {
+				throw Exception("Frame slot %d is not a direct buffer of %lld bytes", i, static_cast<long long>(requiredSize));
+			}
+
+			slotRefs.emplace_back(env, slot);
+			this->slots.push_back(address);
+		}
+
+		this->timestamps = static_cast<int64_t *>(env->GetDirectBufferAddress(timestamps));
+
+		if (!this->timestamps || env->GetDirectBufferCapacity(timestamps) < static_cast<jlong>(count * sizeof(int64_t))) {
+			throw Exception("Timestamps must be a direct buffer of %d longs", count);
+		}
+	}
+
+	size_t VideoFrameRing::frameSize(int width, int height)
+	{
+		const size_t chromaSize = static_cast<size_t>((width + 1) / 2) * ((height + 1) / 2);
+
+		return static_cast<size_t>(width) * height + 2 * chromaSize;
+	}
+
+	void VideoFrameRing::write(const webrtc::VideoFrame & frame)
+	{
+		rtc::scoped_refptr<webrtc::I420BufferInterface> buffer = frame.video_frame_buffer()->ToI420();
+
+		if (buffer->width() != width || buffer->height() != height) {
+			rtc::scoped_refptr<webrtc::I420Buffer> scaled = I420BufferPool::shared().create(width, height);
+			scaled->ScaleFrom(*buffer);
+
+			buffer = scaled;
+		}
+
+		const int64_t count = frameCount.load(std::memory_order_relaxed);
+		const size_t index = static_cast<size_t>(count % static_cast<int64_t>(slots.size()));
+
+		const int chromaWidth = (width + 1) / 2;
+		const int chromaHeight = (height + 1) / 2;
+
+		uint8_t * dstY = slots[index];
+		uint8_t * dstU = dstY + width * height;
+
+		if (format == Format::kNV12) {
+			libyuv::I420ToNV12(
+				buffer->DataY(), buffer->StrideY(),
+				buffer->DataU(), buffer->StrideU(),
+				buffer->DataV(), buffer->StrideV(),
+				dstY, width,
+				dstU, chromaWidth * 2,
+				width, height);
+		}
+		else {
+			libyuv::I420Copy(
+				buffer->DataY(), buffer->StrideY(),
+				buffer->DataU(), buffer->StrideU(),
+				buffer->DataV(), buffer->StrideV(),
+				dstY, width,
+				dstU, chromaWidth,
+				dstU + chromaWidth * chromaHeight, chromaWidth,
+				width, height);
+		}
+
+		timestamps[index] = frame.timestamp_us() * rtc::kNumNanosecsPerMicrosec;
+
+		// Publish the frame after its data has been written.
+		frameCount.store(count + 1, std::memory_order_release);
+	}
+
+	int64_t VideoFrameRing::getFrameCount() const
+	{
+		return frameCount.load(std::memory_order_acquire);
+	}
+
+	VideoFrameRingSink::VideoFrameRingSink(const rtc::scoped_refptr<VideoFrameRing> & ring) :
+		ring(ring)
+	{
+	}
+
+	void VideoFrameRingSink::OnFrame(const webrtc::VideoFrame & frame)
+	{
+		ring->write(frame);
+	}
+}
@@ -15,21 +15,25 @@
  */
 
 #include "media/video/VideoTrackDesktopSource.h"
+#include "media/video/I420BufferPool.h"
 #include "Exception.h"
 
 #include "api/video/i420_buffer.h"
 #include "libyuv/convert.h"
+#include "libyuv/planar_functions.h"
 #include "modules/desktop_capture/cropping_window_capturer.h"
 #include "modules/desktop_capture/desktop_capture_options.h"
 #include "modules/video_capture/video_capture_factory.h"
 #include "third_party/libyuv/include/libyuv/video_common.h"
 #include "rtc_base/logging.h"
-#include "system_wrappers/include/sleep.h"
+#include "rtc_base/time_utils.h"
 
 #include "modules/desktop_capture/desktop_capturer.h"
 #include "modules/desktop_capture/desktop_and_cursor_composer.h"
 #include "modules/desktop_capture/mouse_cursor_monitor.h"
 
+#include <algorithm>
+
 namespace jni
 {
 	VideoTrackDesktopSource::VideoTrackDesktopSource() :
@@ -39,7 +43,13 @@ namespace jni
 		focusSelectedSource(true),
 		sourceState(kInitializing),
 		sourceId(-1),
-		sourceIsWindow(false)
+		sourceIsWindow(false),
+		damageReported(false),
+		lastFrameTime(0),
+		nextFrameTime(0),
+		statsWindowStart(0),
+		windowFrames(0),
+		windowCaptureTime(0)
 	{
 	}
 
@@ -69,10 +79,23 @@ namespace jni
 		this->focusSelectedSource = focus;
 	}
 
+	void VideoTrackDesktopSource::setConversionStripes(int stripes)
+	{
+		converter.setStripes(stripes);
+	}
+
 	void VideoTrackDesktopSource::start()
 	{
 		isCapturing = true;
 
+		{
+			std::unique_lock<std::mutex> lock(statsMutex);
+
+			stats = Stats();
+			windowFrames = 0;
+			windowCaptureTime = 0;
+		}
+
 		captureThread = rtc::Thread::Create();
 		captureThread->Start();
 		captureThread->PostTask(RTC_FROM_HERE, [&] { capture(); });
@@ -80,9 +103,11 @@ namespace jni
 
 	void VideoTrackDesktopSource::stop()
 	{
-		if (isCapturing) {
+		if (captureThread) {
 			isCapturing = false;
 
+			// The capturer belongs to the capture thread.
+			captureThread->Invoke<void>(RTC_FROM_HERE, [&] { capturer.reset(); });
 			captureThread->Stop();
 			captureThread.reset();
 		}
@@ -118,7 +143,9 @@ namespace jni
 				RTC_LOG(LS_ERROR) << "Permanent error capturing desktop frame. Stopping track.";
 
 				terminate();
-				stop();
+
+				// Called on the capture thread, only end the capture loop here.
+				isCapturing = false;
 			}
 			
 			return;
@@ -128,24 +155,34 @@ namespace jni
 		int height = frame->size().height();
 
 		if (width == 1 && height == 1) {
-			// Window has been minimized (hidden).
-			if (lastFrame != nullptr) {
-				process(lastFrame);
-			}
+			// Window has been minimized (hidden), keep showing the last frame.
+			repeatLastFrame(rtc::TimeMicros());
 		}
 		else {
-			// Copy current frame as backup, in order to show it when the window is minimized.
-			lastFrame.reset(new webrtc::BasicDesktopFrame(webrtc::DesktopSize(width, height)));
-			lastFrame->CopyPixelsFrom(frame->data(), frame->stride(), webrtc::DesktopRect::MakeWH(width, height));
-
 			process(frame);
 		}
 	}
 
-	void VideoTrackDesktopSource::process(std::unique_ptr<webrtc::DesktopFrame> & frame)
+	bool VideoTrackDesktopSource::processFrame(std::unique_ptr<webrtc::DesktopFrame> frame, bool drop)
+	{
+		if (isCapturing) {
+			// The capture thread owns the conversion state.
+			return false;
+		}
+
+		process(frame, drop);
+
+		return true;
+	}
+
+	void VideoTrackDesktopSource::process(std::unique_ptr<webrtc::DesktopFrame> & frame, bool drop)
 	{
 		int64_t time = rtc::TimeMicros();
 
+		// Collect the changed areas until a frame is delivered. Otherwise the areas of
+		// dropped or failed frames would never be converted into the reused buffer.
+		pendingDamage.AddRegion(frame->updated_region());
+
 		int width = frame->size().width();
 		int height = frame->size().height();
 		
@@ -157,7 +194,7 @@ namespace jni
 		int crop_w = width;
 		int crop_h = height;
 
-		if (!AdaptFrame(width, height, time, &adapted_width, &adapted_height, &crop_w, &crop_h, &crop_x, &crop_y)) {
+		if (drop || !AdaptFrame(width, height, time, &adapted_width, &adapted_height, &crop_w, &crop_h, &crop_x, &crop_y)) {
 			// Drop frame in order to respect frame rate constraint.
 			return;
 		}
@@ -177,59 +214,121 @@ namespace jni
 		}
 #endif
 
-		if (!buffer || buffer->width() != crop_w || buffer->height() != crop_h) {
-			buffer = webrtc::I420Buffer::Create(crop_w, crop_h);
+		if (!maxFrameSize.is_empty()) {
+			// Adapt frame size to contraints.
+			int max_width = maxFrameSize.width();
+			int max_height = maxFrameSize.height();
+
+			if (adapted_width > max_width) {
+				double scale = max_width / (double)adapted_width;
+				adapted_width = max_width;
+				adapted_height = (int)(adapted_height * scale);
+			}
+			else if (adapted_height > max_height) {
+				double scale = max_height / (double)adapted_height;
+				adapted_width = (int)(adapted_width * scale);
+				adapted_height = max_height;
+			}
+		}
+
+		// Video adapter has requested a down-scale, which is done while converting.
+		const bool scale = adapted_width != width || adapted_height != height;
+		const int buffer_w = scale ? adapted_width : crop_w;
+		const int buffer_h = scale ? adapted_height : crop_h;
+
+		if (!frame->updated_region().is_empty()) {
+			damageReported = true;
 		}
 
-		const int conversionResult = libyuv::ConvertToI420(
-			frame->data(),
-			0,
-			buffer->MutableDataY(), buffer->StrideY(),
-			buffer->MutableDataU(), buffer->StrideU(),
-			buffer->MutableDataV(), buffer->StrideV(),
-			crop_x, crop_y,
-			frame->stride() / webrtc::DesktopFrame::kBytesPerPixel, buffer->height(), crop_w, crop_h,
-			libyuv::kRotate0,
-			libyuv::FOURCC_ARGB);
-
-		if (conversionResult >= 0) {
-			if (!maxFrameSize.is_empty()) {
-				// Adapt frame size to contraints.
-				int max_width = maxFrameSize.width();
-				int max_height = maxFrameSize.height();
-
-				if (adapted_width > max_width) {
-					double scale = max_width / (double)adapted_width;
-					adapted_width = max_width;
-					adapted_height = (int)(adapted_height * scale);
+		const webrtc::DesktopRect cropRect = webrtc::DesktopRect::MakeXYWH(crop_x, crop_y, crop_w, crop_h);
+
+		// Capturers that never report updated regions always get a full conversion.
+		const bool fullUpdate = !damageReported || !convertedBuffer || !cropRect.equals(convertedRect) ||
+			convertedBuffer->width() != buffer_w || convertedBuffer->height() != buffer_h;
+
+		webrtc::DesktopRegion damage(pendingDamage);
+		damage.IntersectWith(cropRect);
+
+		if (!fullUpdate && damage.is_empty()) {
+			// Nothing has changed on the screen, skip the conversion.
+			pendingDamage.Clear();
+			repeatLastFrame(time);
+			return;
+		}
+
+		// Frames already passed on may still be in use, e.g. by the encoder, never write into them.
+		rtc::scoped_refptr<webrtc::I420Buffer> buffer = I420BufferPool::shared().create(buffer_w, buffer_h);
+
+		const webrtc::DesktopSize bufferSize(buffer_w, buffer_h);
+
+		if (fullUpdate) {
+			const bool converted = scale
+				? converter.convertScaled(*frame, cropRect, webrtc::DesktopRect::MakeSize(bufferSize), *buffer)
+				: converter.convert(*frame, cropRect, webrtc::DesktopRect::MakeSize(bufferSize), *buffer);
+
+			if (!converted) {
+				return;
+			}
+		}
+		else {
+			// Start with the last converted frame and only convert the changed areas.
+			libyuv::I420Copy(
+				convertedBuffer->DataY(), convertedBuffer->StrideY(),
+				convertedBuffer->DataU(), convertedBuffer->StrideU(),
+				convertedBuffer->DataV(), convertedBuffer->StrideV(),
+				buffer->MutableDataY(), buffer->StrideY(),
+				buffer->MutableDataU(), buffer->StrideU(),
+				buffer->MutableDataV(), buffer->StrideV(),
+				buffer_w, buffer_h);
+
+			damage.Translate(-crop_x, -crop_y);
+
+			if (scale) {
+				// Scaled areas grow by the filter taps and may overlap, merge them first.
+				webrtc::DesktopRegion scaledDamage;
+
+				for (webrtc::DesktopRegion::Iterator it(damage); !it.IsAtEnd(); it.Advance()) {
+					scaledDamage.AddRect(DesktopFrameConverter::scaleRect(it.rect(), cropRect.size(), bufferSize));
 				}
-				else if (adapted_height > max_height) {
-					double scale = max_height / (double)adapted_height;
-					adapted_width = (int)(adapted_width * scale);
-					adapted_height = max_height;
+
+				damage.Swap(&scaledDamage);
+			}
+
+			for (webrtc::DesktopRegion::Iterator it(damage); !it.IsAtEnd(); it.Advance()) {
+				const bool converted = scale
+					? converter.convertScaled(*frame, cropRect, it.rect(), *buffer)
+					: converter.convert(*frame, cropRect, it.rect(), *buffer);
+
+				if (!converted) {
+					return;
 				}
 			}
+		}
+
+		convertedBuffer = buffer;
+		convertedRect = cropRect;
+		pendingDamage.Clear();
 
-			if (adapted_width != width || adapted_height != height) {
-				// Video adapter has requested a down-scale. Allocate a new buffer and return scaled version.
-				rtc::scoped_refptr<webrtc::I420Buffer> scaled_buffer = webrtc::I420Buffer::Create(adapted_width, adapted_height);
+		deliverFrame(buffer, time);
+	}
 
-				scaled_buffer->ScaleFrom(*buffer);
+	void VideoTrackDesktopSource::deliverFrame(const rtc::scoped_refptr<webrtc::VideoFrameBuffer> & frameBuffer, int64_t time)
+	{
+		lastBuffer = frameBuffer;
+		lastFrameTime = time;
+
+		OnFrame(webrtc::VideoFrame::Builder()
+			.set_video_frame_buffer(frameBuffer)
+			.set_rotation(webrtc::kVideoRotation_0)
+			.set_timestamp_us(time)
+			.build());
+	}
 
-				OnFrame(webrtc::VideoFrame::Builder()
-					.set_video_frame_buffer(scaled_buffer)
-					.set_rotation(webrtc::kVideoRotation_0)
-					.set_timestamp_us(time)
-					.build());
-			}
-			else {
-				// No adaptations needed, just return the frame as is.
-				OnFrame(webrtc::VideoFrame::Builder()
-					.set_video_frame_buffer(buffer)
-					.set_rotation(webrtc::kVideoRotation_0)
-					.set_timestamp_us(time)
-					.build());
-			}
+	void VideoTrackDesktopSource::repeatLastFrame(int64_t time)
+	{
+		// Repeat the unchanged frame at a low rate, e.g. to let new receivers get a picture.
+		if (lastBuffer && time - lastFrameTime >= kRepeatIntervalUs) {
+			deliverFrame(lastBuffer, time);
 		}
 	}
 
@@ -244,8 +343,6 @@ namespace jni
 		options.set_allow_use_magnification_api(true);
 #endif
 
-		std::unique_ptr<webrtc::DesktopCapturer> capturer;
-
 		if (sourceIsWindow) {
 			capturer.reset(new webrtc::DesktopAndCursorComposer(
 				webrtc::DesktopCapturer::CreateWindowCapturer(options),
@@ -270,12 +367,70 @@ namespace jni
 
 		sourceState = kLive;
 
-		int msPerFrame = 1000 / frameRate;
+		nextFrameTime = rtc::TimeMicros();
+		statsWindowStart = nextFrameTime;
+
+		captureFrame();
+	}
+
+	void VideoTrackDesktopSource::captureFrame()
+	{
+		if (!isCapturing) {
+			return;
+		}
+
+		const int64_t start = rtc::TimeMicros();
 
-		while (isCapturing) {
-			capturer->CaptureFrame();
+		// Captures and converts the frame synchronously.
+		capturer->CaptureFrame();
 
-			webrtc::SleepMs(msPerFrame);
+		const int64_t end = rtc::TimeMicros();
+		const int64_t interval = rtc::kNumMicrosecsPerSec / std::max<uint16_t>(frameRate, 1);
+
+		// Schedule on absolute deadlines, so that the capture time does not reduce the frame rate.
+		nextFrameTime += interval;
+
+		uint64_t skipped = 0;
+
+		if (nextFrameTime < end) {
+			// Behind schedule, skip the missed frames instead of capturing back to back.
+			skipped = static_cast<uint64_t>((end - nextFrameTime) / interval + 1);
+			nextFrameTime += static_cast<int64_t>(skipped) * interval;
 		}
+
+		updateStats(end, end - start, skipped);
+
+		const int64_t delayMs = (nextFrameTime - end) / rtc::kNumMicrosecsPerMillisec;
+
+		captureThread->PostDelayedTask(RTC_FROM_HERE, [this] { captureFrame(); }, static_cast<uint32_t>(delayMs));
+	}
+
+	void VideoTrackDesktopSource::updateStats(int64_t time, int64_t captureTime, uint64_t skipped)
+	{
+		std::unique_lock<std::mutex> lock(statsMutex);
+
+		stats.framesCaptured++;
+		stats.framesSkipped += skipped;
+
+		windowFrames++;
+		windowCaptureTime += captureTime;
+
+		const int64_t windowLength = time - statsWindowStart;
+
+		if (windowLength >= rtc::kNumMicrosecsPerSec) {
+			stats.frameRate = windowFrames * static_cast<double>(rtc::kNumMicrosecsPerSec) / windowLength;
+			stats.captureTimeMs = windowCaptureTime / static_cast<double>(windowFrames) / rtc::kNumMicrosecsPerMillisec;
+
+			windowFrames = 0;
+			windowCaptureTime = 0;
+			statsWindowStart = time;
+		}
+	}
+
+	VideoTrackDesktopSource::Stats VideoTrackDesktopSource::getStats()
+	{
+		std::unique_lock<std::mutex> lock(statsMutex);
+
+		return stats;
 	}
-}
\ No newline at end of file
+}
@@ -15,6 +15,7 @@
  */
 
 #include "media/video/VideoTrackDeviceSource.h"
+#include "media/video/I420BufferPool.h"
 #include "Exception.h"
 
 #include "api/video/i420_buffer.h"
@@ -170,7 +171,10 @@ namespace jni
 	{
 		captureModule->RegisterCaptureDataCallback(this);
 
-		capability.videoType = webrtc::VideoType::kI420;
+		// Keep the native format of the selected capability, e.g. MJPEG for high resolutions.
+		if (capability.videoType == webrtc::VideoType::kUnknown) {
+			capability.videoType = webrtc::VideoType::kI420;
+		}
 
 		return captureModule->StartCapture(capability) == 0;
 	}
@@ -196,8 +200,8 @@ namespace jni
 		}
 
 		if (outHeight != frame.height() || outWidth != frame.width()) {
-			// Video adapter has requested a down-scale. Allocate a new buffer and return scaled version.
-			rtc::scoped_refptr<webrtc::I420Buffer> scaled_buffer = webrtc::I420Buffer::Create(outWidth, outHeight);
+			// Video adapter has requested a down-scale. Take a pooled buffer and return scaled version.
+			rtc::scoped_refptr<webrtc::I420Buffer> scaled_buffer = I420BufferPool::shared().create(outWidth, outHeight);
 
 			scaled_buffer->ScaleFrom(*frame.video_frame_buffer()->ToI420());
 			
@@ -16,12 +16,11 @@
 
 #include "media/video/desktop/DesktopCaptureCallback.h"
 #include "media/video/desktop/DesktopFrame.h"
+#include "media/video/I420BufferPool.h"
 #include "JavaClasses.h"
 #include "JavaEnums.h"
 #include "JNI_WebRTC.h"
 
-#include "libyuv/convert.h"
-#include "libyuv/video_common.h"
 #include "modules/desktop_capture/desktop_frame.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/time_utils.h"
@@ -72,26 +71,15 @@ namespace jni
 		}
 #endif
 
-		if (!i420Buffer || i420Buffer->width() != crop_w || i420Buffer->height() != crop_h) {
-			i420Buffer = webrtc::I420Buffer::Create(crop_w, crop_h);
-		}
+		// Consumers may retain the Java frame, never write into a buffer passed on before.
+		rtc::scoped_refptr<webrtc::I420Buffer> i420Buffer = I420BufferPool::shared().create(crop_w, crop_h);
+
+		const webrtc::DesktopRect cropRect = webrtc::DesktopRect::MakeXYWH(crop_x, crop_y, crop_w, crop_h);
 
-		const int conversionResult = libyuv::ConvertToI420(
-			frame->data(),
-			0,
-			i420Buffer->MutableDataY(), i420Buffer->StrideY(),
-			i420Buffer->MutableDataU(), i420Buffer->StrideU(),
-			i420Buffer->MutableDataV(), i420Buffer->StrideV(),
-			crop_x, crop_y,
-			frame->stride() / webrtc::DesktopFrame::kBytesPerPixel, i420Buffer->height(), crop_w, crop_h,
-			libyuv::kRotate0,
-			libyuv::FOURCC_ARGB);
-		
-		if (conversionResult < 0) {
-			RTC_LOG(LS_ERROR) << "Failed to convert desktop frame to I420";
+		if (!converter.convert(*frame, cropRect, webrtc::DesktopRect::MakeWH(crop_w, crop_h), *i420Buffer)) {
 			return;
 		}
-		
+
 		jint rotation = static_cast<jint>(webrtc::kVideoRotation_0);
 		jlong timestamp = rtc::TimeMicros() * rtc::kNumNanosecsPerMicrosec;
 
@@ -101,6 +89,9 @@ namespace jni
 		env->CallVoidMethod(callback, javaClass->onCaptureResult, jresult.get(), jFrame);
 		env->DeleteLocalRef(jBuffer);
 		env->DeleteLocalRef(jFrame);
+
+		// Drop the reference of the Java frame, consumers keep the frame with retain().
+		i420Buffer->Release();
 	}
 
 	DesktopCaptureCallback::JavaDesktopCaptureCallbackClass::JavaDesktopCaptureCallbackClass(JNIEnv * env)
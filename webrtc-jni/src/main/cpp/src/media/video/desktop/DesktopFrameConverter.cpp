@@ -0,0 +1,174 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "media/video/desktop/DesktopFrameConverter.h"
+#include "media/ThreadPool.h"
+
+#include "libyuv/convert.h"
+#include "libyuv/scale_argb.h"
+#include "rtc_base/logging.h"
+
+#include <algorithm>
+
+namespace jni
+{
+	// Smaller stripes do not pay off the synchronization with the workers.
+	static const int kMinStripeRows = 64;
+	static const int kMaxStripes = 16;
+
+	DesktopFrameConverter::DesktopFrameConverter(int stripes) :
+		stripes(stripes)
+	{
+	}
+
+	void DesktopFrameConverter::setStripes(int stripes)
+	{
+		this->stripes = std::max(stripes, 0);
+	}
+
+	bool DesktopFrameConverter::convert(const webrtc::DesktopFrame & frame, const webrtc::DesktopRect & cropRect,
+		const webrtc::DesktopRect & rect, webrtc::I420Buffer & buffer)
+	{
+		// Align to even coordinates, chroma samples cover 2x2 pixels.
+		const int left = rect.left() & ~1;
+		const int top = rect.top() & ~1;
+		const int right = std::min(rect.right() + (rect.right() & 1), cropRect.width());
+		const int bottom = std::min(rect.bottom() + (rect.bottom() & 1), cropRect.height());
+
+		if (right <= left || bottom <= top) {
+			return true;
+		}
+
+		const int height = bottom - top;
+		const int rows = stripeHeight(height);
+
+		std::atomic<bool> failed(false);
+
+		ThreadPool::shared().parallelFor((height + rows - 1) / rows, [&](size_t stripe) {
+			const int y = top + static_cast<int>(stripe) * rows;
+			const int h = std::min(rows, bottom - y);
+
+			const uint8_t * src = frame.GetFrameDataAtPos(webrtc::DesktopVector(cropRect.left() + left, cropRect.top() + y));
+
+			const int result = libyuv::ARGBToI420(
+				src, frame.stride(),
+				buffer.MutableDataY() + y * buffer.StrideY() + left, buffer.StrideY(),
+				buffer.MutableDataU() + y / 2 * buffer.StrideU() + left / 2, buffer.StrideU(),
+				buffer.MutableDataV() + y / 2 * buffer.StrideV() + left / 2, buffer.StrideV(),
+				right - left, h);
+
+			if (result < 0) {
+				failed = true;
+			}
+		});
+
+		if (failed) {
+			RTC_LOG(LS_ERROR) << "Failed to convert desktop frame to I420";
+			return false;
+		}
+
+		return true;
+	}
+
+	bool DesktopFrameConverter::convertScaled(const webrtc::DesktopFrame & frame, const webrtc::DesktopRect & cropRect,
+		const webrtc::DesktopRect & rect, webrtc::I420Buffer & buffer)
+	{
+		const int width = buffer.width();
+		const int height = buffer.height();
+
+		// Align to even coordinates, chroma samples cover 2x2 pixels.
+		const int left = rect.left() & ~1;
+		const int top = rect.top() & ~1;
+		const int right = std::min(rect.right() + (rect.right() & 1), width);
+		const int bottom = std::min(rect.bottom() + (rect.bottom() & 1), height);
+
+		if (right <= left || bottom <= top) {
+			return true;
+		}
+
+		const int stride = width * webrtc::DesktopFrame::kBytesPerPixel;
+		const int rows = stripeHeight(bottom - top);
+
+		scaled.resize(static_cast<size_t>(stride) * height);
+
+		const uint8_t * src = frame.GetFrameDataAtPos(cropRect.top_left());
+
+		std::atomic<bool> failed(false);
+
+		ThreadPool::shared().parallelFor((bottom - top + rows - 1) / rows, [&](size_t stripe) {
+			const int y = top + static_cast<int>(stripe) * rows;
+			const int h = std::min(rows, bottom - y);
+
+			// Scales only the pixels of this stripe, while sampling from the whole source.
+			int result = libyuv::ARGBScaleClip(
+				src, frame.stride(), cropRect.width(), cropRect.height(),
+				scaled.data(), stride, width, height,
+				left, y, right - left, h,
+				libyuv::kFilterBox);
+
+			if (result == 0) {
+				result = libyuv::ARGBToI420(
+					scaled.data() + y * stride + left * webrtc::DesktopFrame::kBytesPerPixel, stride,
+					buffer.MutableDataY() + y * buffer.StrideY() + left, buffer.StrideY(),
+					buffer.MutableDataU() + y / 2 * buffer.StrideU() + left / 2, buffer.StrideU(),
+					buffer.MutableDataV() + y / 2 * buffer.StrideV() + left / 2, buffer.StrideV(),
+					right - left, h);
+			}
+
+			if (result < 0) {
+				failed = true;
+			}
+		});
+
+		if (failed) {
+			RTC_LOG(LS_ERROR) << "Failed to scale desktop frame to I420";
+			return false;
+		}
+
+		return true;
+	}
+
+	webrtc::DesktopRect DesktopFrameConverter::scaleRect(const webrtc::DesktopRect & rect,
+		const webrtc::DesktopSize & srcSize, const webrtc::DesktopSize & dstSize)
+	{
+		const int64_t srcW = std::max(srcSize.width(), 1);
+		const int64_t srcH = std::max(srcSize.height(), 1);
+
+		// Round outwards and add one pixel for the filter taps at the edges.
+		const int left = static_cast<int>(rect.left() * dstSize.width() / srcW) - 1;
+		const int top = static_cast<int>(rect.top() * dstSize.height() / srcH) - 1;
+		const int right = static_cast<int>((rect.right() * dstSize.width() + srcW - 1) / srcW) + 1;
+		const int bottom = static_cast<int>((rect.bottom() * dstSize.height() + srcH - 1) / srcH) + 1;
+
+		webrtc::DesktopRect scaledRect = webrtc::DesktopRect::MakeLTRB(left, top, right, bottom);
+		scaledRect.IntersectWith(webrtc::DesktopRect::MakeSize(dstSize));
+
+		return scaledRect;
+	}
+
+	int DesktopFrameConverter::stripeHeight(int height) const
+	{
+		int count = stripes;
+
+		if (count == 0) {
+			count = static_cast<int>(ThreadPool::shared().size()) + 1;
+		}
+
+		count = std::max(std::min({ count, kMaxStripes, height / kMinStripeRows }), 1);
+
+		// Even stripe heights keep the chroma rows aligned with the luma rows.
+		return ((height + count - 1) / count + 1) & ~1;
+	}
+}
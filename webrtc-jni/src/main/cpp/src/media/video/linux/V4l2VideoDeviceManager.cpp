@@ -34,7 +34,8 @@ namespace jni
 {
 	namespace avdev
 	{
-		V4l2VideoDeviceManager::V4l2VideoDeviceManager()
+		V4l2VideoDeviceManager::V4l2VideoDeviceManager() :
+			cacheGeneration(0)
 		{
 			udev = udev_new();
 
@@ -135,6 +136,43 @@ namespace jni
 		}
 
 		std::set<VideoCaptureCapability> V4l2VideoDeviceManager::getVideoCaptureCapabilities(const VideoDevice & device)
+		{
+			uint64_t generation;
+
+			{
+				std::unique_lock<std::mutex> lock(cacheMutex);
+
+				auto it = capabilityCache.find(device.getDescriptor());
+
+				if (it != capabilityCache.end()) {
+					return it->second;
+				}
+
+				generation = cacheGeneration;
+			}
+
+			// Query without holding the lock, other devices must not wait for this one.
+			std::set<VideoCaptureCapability> capabilities = queryCapabilities(device);
+
+			std::unique_lock<std::mutex> lock(cacheMutex);
+
+			// A device changed during the query, the result may be stale. Let the invalidation win.
+			if (generation == cacheGeneration) {
+				capabilityCache[device.getDescriptor()] = capabilities;
+			}
+
+			return capabilities;
+		}
+
+		void V4l2VideoDeviceManager::invalidateCapabilities(const std::string & descriptor)
+		{
+			std::unique_lock<std::mutex> lock(cacheMutex);
+
+			capabilityCache.erase(descriptor);
+			cacheGeneration++;
+		}
+
+		std::set<VideoCaptureCapability> V4l2VideoDeviceManager::queryCapabilities(const VideoDevice & device)
 		{
 			v4l2_capability vcap = { 0 };
 
@@ -237,6 +275,11 @@ namespace jni
 					const char * node = udev_device_get_devnode(dev);
 					const char * name = udev_device_get_property_value(dev, "ID_V4L_PRODUCT");
 
+					if (node) {
+						// Device nodes are reused, a new or changed device may have other formats.
+						invalidateCapabilities(node);
+					}
+
 					if (strcmp(action, UDEV_ADD) == 0 && checkDevice(node)) {
 						addDevice(name, node);
 					}
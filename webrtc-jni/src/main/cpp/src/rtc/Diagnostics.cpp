@@ -0,0 +1,69 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "rtc/Diagnostics.h"
+#include "media/video/I420BufferPool.h"
+#include "JavaClasses.h"
+#include "JNI_WebRTC.h"
+
+#include <atomic>
+
+namespace jni
+{
+	namespace Diagnostics
+	{
+		static std::atomic<int64_t> counters[static_cast<int>(Counter::kCount)];
+
+		void increment(Counter counter)
+		{
+			counters[static_cast<int>(counter)].fetch_add(1, std::memory_order_relaxed);
+		}
+
+		void decrement(Counter counter)
+		{
+			counters[static_cast<int>(counter)].fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		int64_t get(Counter counter)
+		{
+			return counters[static_cast<int>(counter)].load(std::memory_order_relaxed);
+		}
+
+		JavaLocalRef<jobject> toJava(JNIEnv * env)
+		{
+			const auto javaClass = JavaClasses::get<JavaWebRTCDiagnosticsClass>(env);
+			const I420BufferPool::Stats poolStats = I420BufferPool::shared().getStats();
+
+			jobject obj = env->NewObject(javaClass->cls, javaClass->ctor,
+				static_cast<jlong>(get(Counter::kPeerConnections)),
+				static_cast<jlong>(get(Counter::kPeerConnectionObservers)),
+				static_cast<jlong>(get(Counter::kDataChannelObservers)),
+				static_cast<jlong>(get(Counter::kVideoTrackSinks)),
+				static_cast<jlong>(get(Counter::kAudioTrackSinks)),
+				static_cast<jlong>(JavaGlobalRefCount().load(std::memory_order_relaxed)),
+				static_cast<jlong>(poolStats.buffers),
+				static_cast<jlong>(poolStats.bytes));
+
+			return JavaLocalRef<jobject>(env, obj);
+		}
+
+		JavaWebRTCDiagnosticsClass::JavaWebRTCDiagnosticsClass(JNIEnv * env)
+		{
+			cls = FindClass(env, PKG"WebRTCDiagnostics");
+
+			ctor = GetMethod(env, cls, "<init>", "(JJJJJJJJ)V");
+		}
+	}
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "rtc/EmulatedNetwork.h"
+
+#include "p2p/base/basic_packet_socket_factory.h"
+#include "p2p/client/basic_port_allocator.h"
+
+namespace jni
+{
+	EmulatedNetwork::EmulatedNetwork(rtc::Thread * networkThread, rtc::NetworkManager * networkManager) :
+		networkThread(networkThread),
+		networkManager(networkManager),
+		socketFactory(std::make_unique<rtc::BasicPacketSocketFactory>(networkThread->socketserver()))
+	{
+	}
+
+	rtc::Thread * EmulatedNetwork::getNetworkThread() const
+	{
+		return networkThread;
+	}
+
+	std::unique_ptr<cricket::PortAllocator> EmulatedNetwork::createPortAllocator() const
+	{
+		return std::make_unique<cricket::BasicPortAllocator>(networkManager, socketFactory.get());
+	}
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if defined(WEBRTC_NETWORK_EMULATION)
+
+#include "rtc/NetworkEmulation.h"
+#include "Exception.h"
+#include "JavaClasses.h"
+#include "JavaObject.h"
+#include "JNI_WebRTC.h"
+
+#include "api/test/create_network_emulation_manager.h"
+
+namespace jni
+{
+	NetworkEmulation::NetworkEmulation() :
+		manager(webrtc::CreateNetworkEmulationManager(webrtc::TimeMode::kRealTime))
+	{
+	}
+
+	EmulatedNetwork * NetworkEmulation::createNetwork()
+	{
+		webrtc::EmulatedEndpoint * endpoint = manager->CreateEndpoint(webrtc::EmulatedEndpointConfig());
+		webrtc::EmulatedNetworkManagerInterface * networkInterface = manager->CreateEmulatedNetworkManagerInterface({ endpoint });
+
+		networks.push_back(std::make_unique<EmulatedNetwork>(networkInterface->network_thread(), networkInterface->network_manager()));
+
+		EmulatedNetwork * network = networks.back().get();
+
+		endpoints[network] = endpoint;
+
+		return network;
+	}
+
+	void NetworkEmulation::createLink(EmulatedNetwork * from, EmulatedNetwork * to, const webrtc::BuiltInNetworkBehaviorConfig & config)
+	{
+		Link link(from, to);
+
+		if (links.find(link) != links.end()) {
+			throw Exception("Link between the networks already exists");
+		}
+
+		webrtc::EmulatedEndpoint * fromEndpoint = getEndpoint(from);
+		webrtc::EmulatedEndpoint * toEndpoint = getEndpoint(to);
+
+		auto node = manager->NodeBuilder().config(config).Build();
+
+		manager->CreateRoute(fromEndpoint, { node.node }, toEndpoint);
+
+		links[link] = node.simulation;
+	}
+
+	void NetworkEmulation::updateLink(EmulatedNetwork * from, EmulatedNetwork * to, const webrtc::BuiltInNetworkBehaviorConfig & config)
+	{
+		auto found = links.find(Link(from, to));
+
+		if (found == links.end()) {
+			throw Exception("No link between the networks");
+		}
+
+		// Applies to packets entering the link from now on.
+		found->second->SetConfig(config);
+	}
+
+	webrtc::EmulatedEndpoint * NetworkEmulation::getEndpoint(EmulatedNetwork * network) const
+	{
+		auto found = endpoints.find(network);
+
+		if (found == endpoints.end()) {
+			throw Exception("Network was not created by this emulation");
+		}
+
+		return found->second;
+	}
+
+	namespace NetworkEmulationConfig
+	{
+		webrtc::BuiltInNetworkBehaviorConfig toNative(JNIEnv * env, const JavaRef<jobject> & javaType)
+		{
+			const auto javaClass = JavaClasses::get<JavaNetworkEmulationConfigClass>(env);
+
+			JavaObject obj(env, javaType);
+
+			webrtc::BuiltInNetworkBehaviorConfig config;
+			config.queue_length_packets = static_cast<size_t>(obj.getInt(javaClass->queueLengthPackets));
+			config.queue_delay_ms = obj.getInt(javaClass->queueDelayMs);
+			config.delay_standard_deviation_ms = obj.getInt(javaClass->delayStandardDeviationMs);
+			config.link_capacity_kbps = obj.getInt(javaClass->linkCapacityKbps);
+			config.loss_percent = obj.getInt(javaClass->lossPercent);
+			config.allow_reordering = obj.getBoolean(javaClass->allowReordering);
+			config.avg_burst_loss_length = obj.getInt(javaClass->avgBurstLossLength);
+
+			return config;
+		}
+
+		JavaNetworkEmulationConfigClass::JavaNetworkEmulationConfigClass(JNIEnv * env)
+		{
+			cls = FindClass(env, PKG"NetworkEmulationConfig");
+
+			queueLengthPackets = GetFieldID(env, cls, "queueLengthPackets", "I");
+			queueDelayMs = GetFieldID(env, cls, "queueDelayMs", "I");
+			delayStandardDeviationMs = GetFieldID(env, cls, "delayStandardDeviationMs", "I");
+			linkCapacityKbps = GetFieldID(env, cls, "linkCapacityKbps", "I");
+			lossPercent = GetFieldID(env, cls, "lossPercent", "I");
+			allowReordering = GetFieldID(env, cls, "allowReordering", "Z");
+			avgBurstLossLength = GetFieldID(env, cls, "avgBurstLossLength", "I");
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package dev.onvoid.webrtc;
+
+import dev.onvoid.webrtc.internal.NativeObject;
+
+/**
+ * The emulated network of one peer, created by a {@link NetworkEmulation}. A
+ * {@link PeerConnectionFactory} created with an emulated network sends and
+ * receives all packets of its peer connections on this network only.
+ *
+ * @author Alex Andres
+ */
+public class EmulatedNetwork extends NativeObject {
+
+	/**
+	 * Constructor used by the native api.
+	 */
+	private EmulatedNetwork() {
+
+	}
+
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package dev.onvoid.webrtc;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+import dev.onvoid.webrtc.internal.NativeLoader;
+
+/**
+ * In-process network emulation to run peer connections over simulated links
+ * with configurable delay, jitter, loss and capacity. All traffic stays in the
+ * process, which makes throughput and recovery measurements repeatable.
+ * <p>
+ * The emulation is only available when the native library has been built
+ * with network emulation support, see {@link #isSupported()}. It must be
+ * disposed after all {@link PeerConnectionFactory}s using its networks.
+ *
+ * @author Alex Andres
+ */
+public class NetworkEmulation extends DisposableNativeObject {
+
+	static {
+		try {
+			NativeLoader.loadLibrary("webrtc-java");
+		}
+		catch (Exception e) {
+			throw new RuntimeException("Load library 'webrtc-java' failed", e);
+		}
+	}
+
+	/**
+	 * Creates a new network emulation.
+	 *
+	 * @throws RuntimeException if the native library has been built without
+	 *                          network emulation support.
+	 */
+	public NetworkEmulation() {
+		initialize();
+	}
+
+	/**
+	 * Indicates whether the native library has been built with network
+	 * emulation support.
+	 *
+	 * @return true if the network emulation is available.
+	 */
+	public static native boolean isSupported();
+
+	/**
+	 * Creates a new network with a single emulated endpoint. Packets can be
+	 * exchanged with other networks after links have been created.
+	 *
+	 * @return The created network.
+	 */
+	public native EmulatedNetwork createNetwork();
+
+	/**
+	 * Creates a one-way link carrying the packets sent from one network to
+	 * another. Create a link for each direction to connect two networks.
+	 *
+	 * @param from   The sending network.
+	 * @param to     The receiving network.
+	 * @param config The behavior of the link.
+	 */
+	public native void createLink(EmulatedNetwork from, EmulatedNetwork to,
+			NetworkEmulationConfig config);
+
+	/**
+	 * Changes the behavior of an existing link while packets are flowing, e.g.
+	 * to measure the recovery after a period of heavy loss.
+	 *
+	 * @param from   The sending network.
+	 * @param to     The receiving network.
+	 * @param config The new behavior of the link.
+	 */
+	public native void updateLink(EmulatedNetwork from, EmulatedNetwork to,
+			NetworkEmulationConfig config);
+
+	@Override
+	public native void dispose();
+
+	private native void initialize();
+
+}
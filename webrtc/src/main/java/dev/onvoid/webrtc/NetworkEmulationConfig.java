@@ -0,0 +1,73 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package dev.onvoid.webrtc;
+
+/**
+ * Describes the behavior of a simulated link between two {@link
+ * EmulatedNetwork}s. The default values describe an ideal link without delay,
+ * loss and capacity limit.
+ *
+ * @author Alex Andres
+ */
+public class NetworkEmulationConfig {
+
+	/**
+	 * Maximum number of packets in the queue of the link, zero means no limit.
+	 */
+	public int queueLengthPackets;
+
+	/**
+	 * The delay in milliseconds every packet spends on the link.
+	 */
+	public int queueDelayMs;
+
+	/**
+	 * The standard deviation of the delay in milliseconds, adds jitter to the
+	 * packet delay.
+	 */
+	public int delayStandardDeviationMs;
+
+	/**
+	 * The capacity of the link in kbit/s, zero means no limit.
+	 */
+	public int linkCapacityKbps;
+
+	/**
+	 * The probability in percent for a packet to be lost.
+	 */
+	public int lossPercent;
+
+	/**
+	 * If true, packets may be delivered in a different order due to jitter.
+	 */
+	public boolean allowReordering;
+
+	/**
+	 * The average length of a burst of lost packets, -1 for independent
+	 * random losses.
+	 */
+	public int avgBurstLossLength = -1;
+
+
+	@Override
+	public String toString() {
+		return String.format("%s@%d [queueLengthPackets=%s, queueDelayMs=%s, delayStandardDeviationMs=%s, linkCapacityKbps=%s, lossPercent=%s, allowReordering=%s, avgBurstLossLength=%s]",
+				NetworkEmulationConfig.class.getSimpleName(), hashCode(),
+				queueLengthPackets, queueDelayMs, delayStandardDeviationMs,
+				linkCapacityKbps, lossPercent, allowReordering,
+				avgBurstLossLength);
+	}
+}
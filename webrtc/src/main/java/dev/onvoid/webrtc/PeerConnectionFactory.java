@@ -50,6 +50,9 @@ public class PeerConnectionFactory extends DisposableNativeObject {
 	@SuppressWarnings("unused")
 	private long networkThreadHandle;
 
+	@SuppressWarnings("unused")
+	private long networkHandle;
+
 	@SuppressWarnings("unused")
 	private long signalingThreadHandle;
 
@@ -71,7 +74,7 @@ public class PeerConnectionFactory extends DisposableNativeObject {
 	 * @param audioProcessing The custom audio processing module.
 	 */
 	public PeerConnectionFactory(AudioProcessing audioProcessing) {
-		initialize(null, audioProcessing);
+		initialize(null, audioProcessing, null);
 	}
 
 	/**
@@ -81,7 +84,7 @@ public class PeerConnectionFactory extends DisposableNativeObject {
 	 * @param audioModule The custom audio device module.
 	 */
 	public PeerConnectionFactory(AudioDeviceModule audioModule) {
-		initialize(audioModule, null);
+		initialize(audioModule, null, null);
 	}
 
 	/**
@@ -93,7 +96,20 @@ public class PeerConnectionFactory extends DisposableNativeObject {
 	 */
 	public PeerConnectionFactory(AudioDeviceModule audioModule,
 			AudioProcessing audioProcessing) {
-		initialize(audioModule, audioProcessing);
+		initialize(audioModule, audioProcessing, null);
+	}
+
+	/**
+	 * Creates an instance of PeerConnectionFactory on the provided emulated
+	 * network. All peer connections created by this factory will use the
+	 * emulated network only.
+	 *
+	 * @param network The emulated network to connect on.
+	 *
+	 * @see NetworkEmulation
+	 */
+	public PeerConnectionFactory(EmulatedNetwork network) {
+		initialize(null, null, network);
 	}
 
 	/**
@@ -170,6 +186,6 @@ public class PeerConnectionFactory extends DisposableNativeObject {
 	public native void dispose();
 
 	private native void initialize(AudioDeviceModule audioModule,
-			AudioProcessing audioProcessing);
+			AudioProcessing audioProcessing, EmulatedNetwork network);
 
 }
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc;
+
+/**
+ * An RTCBandwidthEstimationObserver is notified about changes of the send-side
+ * bandwidth estimate of an {@link RTCPeerConnection}. To avoid needless calls,
+ * only changes of at least five percent are reported.
+ *
+ * @author Alex Andres
+ */
+public interface RTCBandwidthEstimationObserver {
+
+	/**
+	 * The estimated available outgoing bitrate has changed.
+	 *
+	 * @param availableOutgoingBitrate The estimated bitrate in bits per second
+	 *                                 available for sending on the selected
+	 *                                 candidate pair.
+	 */
+	void onBandwidthEstimate(long availableOutgoingBitrate);
+
+}
@@ -28,6 +28,14 @@ import java.nio.ByteBuffer;
  */
 public class RTCDataChannel extends DisposableNativeObject {
 
+	/**
+	 * Handle to the native observer, deleted when the observer is unregistered
+	 * or replaced.
+	 */
+	@SuppressWarnings("unused")
+	private long observerHandle;
+
+
 	/**
 	 * Used by the native api.
 	 */
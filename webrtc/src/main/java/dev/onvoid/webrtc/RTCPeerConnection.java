@@ -37,6 +37,12 @@ public class RTCPeerConnection extends NativeObject {
 	@SuppressWarnings("unused")
 	private long observerHandle;
 
+	/**
+	 * Handle to the native bandwidth estimation observer, if set.
+	 */
+	@SuppressWarnings("unused")
+	private long bweObserverHandle;
+
 
 	/**
 	 * Constructor used by the native api.
@@ -324,6 +330,33 @@ public class RTCPeerConnection extends NativeObject {
 	public native void getStats(RTCRtpSender sender,
 			RTCStatsCollectorCallback callback);
 
+	/**
+	 * Sets the bitrate limits for all media sent on this RTCPeerConnection.
+	 * The start bitrate is the initial estimate used before the bandwidth
+	 * estimation has converged. Each call replaces all previously set limits,
+	 * a {@code null} value resets the corresponding limit to the value given
+	 * by the session description or to the default.
+	 *
+	 * @param minBitrate   The minimum bitrate in bits per second.
+	 * @param startBitrate The start bitrate in bits per second.
+	 * @param maxBitrate   The maximum bitrate in bits per second.
+	 */
+	public native void setBitrate(Integer minBitrate, Integer startBitrate,
+			Integer maxBitrate);
+
+	/**
+	 * Sets the observer to receive the send-side bandwidth estimate of this
+	 * RTCPeerConnection. The estimate is read at the specified interval and
+	 * reported only when it changes significantly. Setting a new observer
+	 * replaces the current one, a {@code null} observer removes it.
+	 *
+	 * @param observer   The observer to receive estimate changes.
+	 * @param intervalMs The interval in milliseconds at which the estimate is
+	 *                   read.
+	 */
+	public native void setBandwidthEstimationObserver(
+			RTCBandwidthEstimationObserver observer, int intervalMs);
+
 	/**
 	 * Tells the RTCPeerConnection that ICE should be restarted. Subsequent
 	 * calls to {@code createOffer} will create descriptions that will restart
@@ -33,6 +33,13 @@ public class RTCRtpEncodingParameters {
 	 */
 	public Long ssrc;
 
+	/**
+	 * The RTP stream ID (RID) of this encoding, which identifies a simulcast
+	 * layer. Must be set for each encoding when sending multiple simulcast
+	 * encodings.
+	 */
+	public String rid;
+
 	/**
 	 * Indicates that this encoding is actively being sent. Setting it to false
 	 * causes this encoding to no longer be sent. Setting it to true causes this
@@ -69,6 +76,14 @@ public class RTCRtpEncodingParameters {
 	 */
 	public Double scaleResolutionDownBy;
 
+	/**
+	 * The scalability mode of this encoding, e.g. "L1T3" for three temporal
+	 * layers or "L3T3" for three spatial and three temporal layers, as
+	 * defined in the WebRTC-SVC specification. If unset, the implementation
+	 * chooses the mode.
+	 */
+	public String scalabilityMode;
+
 
 	/**
 	 * Creates an instance of RTCRtpEncodingParameters.
@@ -79,9 +94,11 @@ public class RTCRtpEncodingParameters {
 
 	@Override
 	public String toString() {
-		return "RTCRtpEncodingParameters{" + "ssrc=" + ssrc + ", active="
-				+ active + ", maxBitrate=" + maxBitrate + ", minBitrate="
-				+ minBitrate + ", maxFramerate=" + maxFramerate
-				+ ", scaleResolutionDownBy=" + scaleResolutionDownBy + '}';
+		return "RTCRtpEncodingParameters{" + "ssrc=" + ssrc + ", rid=" + rid
+				+ ", active=" + active + ", maxBitrate=" + maxBitrate
+				+ ", minBitrate=" + minBitrate + ", maxFramerate="
+				+ maxFramerate + ", scaleResolutionDownBy="
+				+ scaleResolutionDownBy + ", scalabilityMode="
+				+ scalabilityMode + '}';
 	}
 }
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc;
+
+import dev.onvoid.webrtc.internal.NativeLoader;
+
+/**
+ * A snapshot of native object and memory counters of the WebRTC library. The
+ * counters help to detect leaks, e.g. a growing number of observers while the
+ * number of peer connections stays constant, and to correlate native memory
+ * with load.
+ *
+ * @author Alex Andres
+ */
+public class WebRTCDiagnostics {
+
+	static {
+		try {
+			NativeLoader.loadLibrary("webrtc-java");
+		}
+		catch (Exception e) {
+			throw new RuntimeException("Load library 'webrtc-java' failed", e);
+		}
+	}
+
+	/** The number of created and not yet closed peer connections. */
+	public final long peerConnections;
+
+	/** The number of live native peer connection observers. */
+	public final long peerConnectionObservers;
+
+	/** The number of live native data channel observers. */
+	public final long dataChannelObservers;
+
+	/** The number of live native video track sinks. */
+	public final long videoTrackSinks;
+
+	/** The number of live native audio track sinks. */
+	public final long audioTrackSinks;
+
+	/** The number of JNI global references held by the native library. */
+	public final long javaGlobalRefs;
+
+	/**
+	 * The number of I420 buffers retained by the native buffer pool and of
+	 * buffers allocated outside of the pool that are still in use.
+	 */
+	public final long i420Buffers;
+
+	/** The size in bytes of all I420 buffers counted in {@link #i420Buffers}. */
+	public final long i420BufferBytes;
+
+
+	public WebRTCDiagnostics(long peerConnections, long peerConnectionObservers,
+			long dataChannelObservers, long videoTrackSinks,
+			long audioTrackSinks, long javaGlobalRefs, long i420Buffers,
+			long i420BufferBytes) {
+		this.peerConnections = peerConnections;
+		this.peerConnectionObservers = peerConnectionObservers;
+		this.dataChannelObservers = dataChannelObservers;
+		this.videoTrackSinks = videoTrackSinks;
+		this.audioTrackSinks = audioTrackSinks;
+		this.javaGlobalRefs = javaGlobalRefs;
+		this.i420Buffers = i420Buffers;
+		this.i420BufferBytes = i420BufferBytes;
+	}
+
+	/**
+	 * Reads the current native counters. The counters are read one after
+	 * another, so they may be slightly inconsistent with each other while
+	 * objects are created or released concurrently.
+	 *
+	 * @return The current counter values.
+	 */
+	public static native WebRTCDiagnostics snapshot();
+
+	@Override
+	public String toString() {
+		return String.format("%s [peerConnections=%s, peerConnectionObservers=%s, dataChannelObservers=%s, videoTrackSinks=%s, audioTrackSinks=%s, javaGlobalRefs=%s, i420Buffers=%s, i420BufferBytes=%s]",
+				WebRTCDiagnostics.class.getSimpleName(),
+				peerConnections, peerConnectionObservers, dataChannelObservers,
+				videoTrackSinks, audioTrackSinks, javaGlobalRefs, i420Buffers,
+				i420BufferBytes);
+	}
+}
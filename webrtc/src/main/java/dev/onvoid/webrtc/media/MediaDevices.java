@@ -22,6 +22,7 @@ import dev.onvoid.webrtc.media.video.VideoCaptureCapability;
 import dev.onvoid.webrtc.media.video.VideoDevice;
 
 import java.util.List;
+import java.util.concurrent.CompletableFuture;
 
 public class MediaDevices {
 
@@ -51,4 +52,18 @@ public class MediaDevices {
 
 	public static native List<VideoCaptureCapability> getVideoCaptureCapabilities(VideoDevice device);
 
+	/**
+	 * Queries the capabilities of the given video capture device without
+	 * blocking the calling thread. Querying a device for the first time may
+	 * take some time, subsequent queries are answered from a cache until the
+	 * device is reconnected.
+	 *
+	 * @param device The video capture device.
+	 *
+	 * @return A future completed with the capabilities of the device.
+	 */
+	public static CompletableFuture<List<VideoCaptureCapability>> getVideoCaptureCapabilitiesAsync(VideoDevice device) {
+		return CompletableFuture.supplyAsync(() -> getVideoCaptureCapabilities(device));
+	}
+
 }
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media;
+
+import static java.util.Objects.requireNonNull;
+
+import dev.onvoid.webrtc.RTCRtpCodecParameters;
+import dev.onvoid.webrtc.RTCRtpParameters;
+import dev.onvoid.webrtc.RTCRtpReceiver;
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+import java.util.Arrays;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Locale;
+import java.util.Set;
+
+/**
+ * Records the encoded media received by a {@link RTCRtpReceiver} to a file
+ * without decoding and re-encoding it. Video is written to IVF files (VP8, VP9,
+ * AV1, H264) and Opus audio to Ogg files. Frames are captured and written
+ * entirely on the native side, the Java API only controls the recording.
+ * <p>
+ * The recorder stays attached to the receiver until the receiver is closed.
+ * When not recording, frames are passed through to the decoder unmodified.
+ *
+ * @author Alex Andres
+ */
+public class MediaRecorder extends DisposableNativeObject {
+
+	private static final Set<String> AUXILIARY_CODECS = new HashSet<>(
+			Arrays.asList("rtx", "red", "ulpfec", "flexfec-03", "cn",
+					"telephone-event"));
+
+	private final RTCRtpReceiver receiver;
+
+
+	/**
+	 * Creates a new {@code MediaRecorder} for the specified receiver. Make sure
+	 * to call {@link #dispose()} to release resources when finished recording.
+	 *
+	 * @param receiver The receiver which media to record.
+	 */
+	public MediaRecorder(RTCRtpReceiver receiver) {
+		requireNonNull(receiver);
+
+		this.receiver = receiver;
+
+		initialize(receiver);
+	}
+
+	/**
+	 * Starts recording to the specified file. The codec of the file is the
+	 * codec of the received media, see {@link #getCodec()}. Video recording
+	 * starts with the next key frame. Received audio of other codecs, e.g.
+	 * comfort noise, is not written to the file.
+	 *
+	 * @param fileName The path of the file to record to.
+	 *
+	 * @throws IllegalStateException if no codec has been negotiated yet.
+	 */
+	public void start(String fileName) {
+		requireNonNull(fileName);
+
+		RTCRtpCodecParameters codec = getCodec();
+		int channels = codec.channels != null ? codec.channels : 1;
+
+		startInternal(fileName, codec.codecName, channels, codec.payloadType);
+	}
+
+	/**
+	 * Closes the current file and continues recording to the specified file.
+	 * No frames are lost during the switch. If not recording, this is the same
+	 * as calling {@link #start(String)}.
+	 *
+	 * @param fileName The path of the new file to record to.
+	 */
+	public void rotate(String fileName) {
+		start(fileName);
+	}
+
+	/**
+	 * Stops recording and closes the current file.
+	 */
+	public native void stop();
+
+	/**
+	 * Checks whether the recorder is currently writing to a file.
+	 *
+	 * @return true if recording, false otherwise.
+	 */
+	public native boolean isRecording();
+
+	@Override
+	public native void dispose();
+
+	/**
+	 * Returns the codec of the received media, identified by the payload type
+	 * of the received frames. Until the first frame has been received, or if
+	 * the payload type is not available, which is the case for video, the
+	 * preferred negotiated codec is returned.
+	 *
+	 * @return The codec of the received media.
+	 *
+	 * @throws IllegalStateException if no codec has been negotiated yet.
+	 */
+	public RTCRtpCodecParameters getCodec() {
+		RTCRtpParameters parameters = receiver.getParameters();
+
+		return findCodec(parameters.codecs, getPayloadType());
+	}
+
+	static RTCRtpCodecParameters findCodec(List<RTCRtpCodecParameters> codecs,
+			int payloadType) {
+		if (codecs == null || codecs.isEmpty()) {
+			throw new IllegalStateException("No codec negotiated for the receiver");
+		}
+
+		for (RTCRtpCodecParameters codec : codecs) {
+			if (codec.payloadType == payloadType) {
+				return codec;
+			}
+		}
+
+		// Skip retransmission, redundancy and signaling formats.
+		for (RTCRtpCodecParameters codec : codecs) {
+			if (!AUXILIARY_CODECS.contains(codec.codecName.toLowerCase(Locale.ROOT))) {
+				return codec;
+			}
+		}
+
+		return codecs.get(0);
+	}
+
+	private native int getPayloadType();
+
+	private native void initialize(RTCRtpReceiver receiver);
+
+	private native void startInternal(String fileName, String codecName,
+			int channels, int payloadType);
+
+}
@@ -18,6 +18,9 @@ package dev.onvoid.webrtc.media.audio;
 
 import dev.onvoid.webrtc.internal.DisposableNativeObject;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
 /**
  * Audio format converter to remix and resample audio input data. This converter
  * operates on audio frames of 10 milliseconds. Each sample is assumed to be a
@@ -93,13 +96,86 @@ public class AudioConverter extends DisposableNativeObject {
 		return dstSamplesOut;
 	}
 
+	/**
+	 * Converts a number of consecutive 10 ms frames in one call. The output
+	 * frames are packed without gaps, so {@code dst} must hold at least {@code
+	 * frames} output frames.
+	 *
+	 * @param src    The audio samples to convert.
+	 * @param dst    The output buffer for converted audio samples.
+	 * @param frames The number of 10 ms frames to convert.
+	 *
+	 * @return The number of converted samples.
+	 *
+	 * @throws IllegalArgumentException if the buffer sizes do not match the
+	 *                                  frame sizes.
+	 */
+	public int convert(byte[] src, byte[] dst, int frames) {
+		checkSizes(src.length / 2, dst.length / 2, frames);
+
+		convertInternal(src, srcSamples * frames, dst, dstSamplesOut * frames);
+
+		return dstSamplesOut * frames;
+	}
+
+	/**
+	 * Converts a number of consecutive 10 ms frames from a direct buffer into
+	 * another direct buffer in one call. Both buffers must be in native byte
+	 * order and are accessed from their beginning, regardless of their
+	 * position. The output frames are packed without gaps.
+	 *
+	 * @param src    The audio samples to convert.
+	 * @param dst    The output buffer for converted audio samples.
+	 * @param frames The number of 10 ms frames to convert.
+	 *
+	 * @return The number of converted samples.
+	 *
+	 * @throws IllegalArgumentException if the buffers are not direct buffers
+	 *                                  or the buffer sizes do not match the
+	 *                                  frame sizes.
+	 */
+	public int convert(ByteBuffer src, ByteBuffer dst, int frames) {
+		if (!src.isDirect() || !dst.isDirect()) {
+			throw new IllegalArgumentException("Buffers must be direct buffers");
+		}
+		if (src.order() != ByteOrder.nativeOrder()
+				|| dst.order() != ByteOrder.nativeOrder()) {
+			throw new IllegalArgumentException("Buffers must be in native byte order");
+		}
+
+		checkSizes(src.capacity() / 2, dst.capacity() / 2, frames);
+
+		convertDirect(src, srcSamples * frames, dst, dstSamplesOut * frames);
+
+		return dstSamplesOut * frames;
+	}
+
 	@Override
 	public native void dispose();
 
+	private void checkSizes(int srcLength, int dstLength, int frames) {
+		if (frames < 1) {
+			throw new IllegalArgumentException("Invalid number of frames: " + frames);
+		}
+		if (srcLength < srcSamples * frames) {
+			throw new IllegalArgumentException(String.format(
+					"Insufficient samples input length: %d vs. %d",
+					srcLength, srcSamples * frames));
+		}
+		if (dstLength < dstSamplesOut * frames) {
+			throw new IllegalArgumentException(String.format(
+					"Insufficient samples output length: %d vs. %d",
+					dstLength, dstSamplesOut * frames));
+		}
+	}
+
 	private native void initialize(int srcSampleRate, int srcChannels,
 			int dstSampleRate, int dstChannels);
 
 	public native void convertInternal(byte[] src, int nSrcSamples, byte[] dst,
 			int nDstSamples);
 
+	private native void convertDirect(ByteBuffer src, int nSrcSamples,
+			ByteBuffer dst, int nDstSamples);
+
 }
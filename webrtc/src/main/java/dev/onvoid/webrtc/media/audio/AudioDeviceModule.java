@@ -43,10 +43,10 @@ public class AudioDeviceModule extends DisposableNativeObject {
 	@Override
 	public void dispose() {
 		if (nonNull(sinkEntry)) {
-			removeSinkInternal(sinkEntry.getValue());
+			detachSink(sinkEntry);
 		}
 		if (nonNull(sourceEntry)) {
-			removeSourceInternal(sourceEntry.getValue());
+			detachSource(sourceEntry);
 		}
 
 		sinkEntry = null;
@@ -63,10 +63,18 @@ public class AudioDeviceModule extends DisposableNativeObject {
 				return;
 			}
 
-			removeSinkInternal(sinkEntry.getValue());
+			detachSink(sinkEntry);
 		}
 
-		final long nativeSink = addSinkInternal(sink);
+		final long nativeSink;
+
+		if (sink instanceof WavAudioFileSink) {
+			// Native sinks receive the audio data without passing it through Java.
+			nativeSink = addFileSinkInternal((WavAudioFileSink) sink);
+		}
+		else {
+			nativeSink = addSinkInternal(sink);
+		}
 
 		sinkEntry = new SimpleEntry<>(sink, nativeSink);
 	}
@@ -79,10 +87,18 @@ public class AudioDeviceModule extends DisposableNativeObject {
 				return;
 			}
 
-			removeSourceInternal(sourceEntry.getValue());
+			detachSource(sourceEntry);
 		}
 
-		final long nativeSource = addSourceInternal(source);
+		final long nativeSource;
+
+		if (isFileSource(source)) {
+			// Native sources provide the audio data without passing it through Java.
+			nativeSource = addFileSourceInternal(source);
+		}
+		else {
+			nativeSource = addSourceInternal(source);
+		}
 
 		sourceEntry = new SimpleEntry<>(source, nativeSource);
 	}
@@ -131,6 +147,29 @@ public class AudioDeviceModule extends DisposableNativeObject {
 
 	public native void setMicrophoneMute(boolean mute);
 
+	private void detachSink(Map.Entry<AudioSink, Long> entry) {
+		if (entry.getKey() instanceof WavAudioFileSink) {
+			removeFileSinkInternal(entry.getValue());
+		}
+		else {
+			removeSinkInternal(entry.getValue());
+		}
+	}
+
+	private void detachSource(Map.Entry<AudioSource, Long> entry) {
+		if (isFileSource(entry.getKey())) {
+			removeFileSourceInternal(entry.getValue());
+		}
+		else {
+			removeSourceInternal(entry.getValue());
+		}
+	}
+
+	private static boolean isFileSource(AudioSource source) {
+		return source instanceof RawAudioFileSource
+				|| source instanceof WavAudioFileSource;
+	}
+
 	private native void initialize(AudioLayer audioLayer);
 
 	private native void disposeInternal();
@@ -139,8 +178,16 @@ public class AudioDeviceModule extends DisposableNativeObject {
 
 	private native void removeSinkInternal(long sinkHandle);
 
+	private native long addFileSinkInternal(WavAudioFileSink sink);
+
+	private native void removeFileSinkInternal(long sinkHandle);
+
 	private native long addSourceInternal(AudioSource source);
 
 	private native void removeSourceInternal(long sourceHandle);
 
+	private native long addFileSourceInternal(AudioSource source);
+
+	private native void removeFileSourceInternal(long sourceHandle);
+
 }
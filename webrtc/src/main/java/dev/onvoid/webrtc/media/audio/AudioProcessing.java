@@ -16,9 +16,14 @@
 
 package dev.onvoid.webrtc.media.audio;
 
+import static java.util.Objects.isNull;
+import static java.util.Objects.requireNonNull;
+
 import dev.onvoid.webrtc.internal.DisposableNativeObject;
 import dev.onvoid.webrtc.internal.NativeLoader;
 
+import java.nio.ByteBuffer;
+
 /**
  * AudioProcessing provides a collection of voice processing components designed
  * for real-time communications software. Accepts only linear PCM audio in
@@ -41,6 +46,15 @@ public class AudioProcessing extends DisposableNativeObject {
 	/** Cached statistics object to avoid recreation. */
 	private final AudioProcessingStats stats = new AudioProcessingStats();
 
+	/** Per-frame statistics backed by a direct buffer. */
+	private final AudioProcessingFrameStats frameStats = new AudioProcessingFrameStats();
+
+	/** Stream formats used with direct buffers. */
+	private AudioProcessingStreamConfig inputConfig;
+	private AudioProcessingStreamConfig outputConfig;
+	private AudioProcessingStreamConfig reverseInputConfig;
+	private AudioProcessingStreamConfig reverseOutputConfig;
+
 
 	/**
 	 * Creates a new instance of {@code AudioProcessing}. Make sure to call
@@ -61,6 +75,20 @@ public class AudioProcessing extends DisposableNativeObject {
 		return stats;
 	}
 
+	/**
+	 * Get the lightweight statistics of the last processed frame, such as
+	 * voice activity and echo delay. Unlike {@link #getStatistics()} this is
+	 * cheap enough to be called after every processed frame. The returned
+	 * object is reused and updated with each call.
+	 *
+	 * @return The statistics of the last processed frame.
+	 */
+	public AudioProcessingFrameStats getFrameStatistics() {
+		updateFrameStats(frameStats.buffer);
+
+		return frameStats;
+	}
+
 	/**
 	 * Calculates the buffer size in bytes for the destination buffer used in
 	 * {@link #processStream} and {@link #processReverseStream}.
@@ -156,11 +184,107 @@ public class AudioProcessing extends DisposableNativeObject {
 			AudioProcessingStreamConfig inputConfig,
 			AudioProcessingStreamConfig outputConfig, byte[] dest);
 
+	/**
+	 * Sets the audio formats used by {@link #processStream(ByteBuffer,
+	 * ByteBuffer, int)}. The formats are kept until changed, so they don't need
+	 * to be passed with every frame.
+	 *
+	 * @param inputConfig  The config that describes the audio input format.
+	 * @param outputConfig The config that describes the desired audio output
+	 *                     format.
+	 */
+	public void setStreamConfig(AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig) {
+		this.inputConfig = requireNonNull(inputConfig);
+		this.outputConfig = requireNonNull(outputConfig);
+	}
+
+	/**
+	 * Sets the audio formats used by {@link #processReverseStream(ByteBuffer,
+	 * ByteBuffer, int)}. The formats are kept until changed, so they don't need
+	 * to be passed with every frame.
+	 *
+	 * @param inputConfig  The config that describes the audio input format.
+	 * @param outputConfig The config that describes the desired audio output
+	 *                     format.
+	 */
+	public void setReverseStreamConfig(AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig) {
+		this.reverseInputConfig = requireNonNull(inputConfig);
+		this.reverseOutputConfig = requireNonNull(outputConfig);
+	}
+
+	/**
+	 * Processes a number of consecutive 10 ms frames of interleaved 16-bit PCM
+	 * audio in one call. The audio formats must be set with {@link
+	 * #setStreamConfig} beforehand. Both buffers must be direct buffers in
+	 * native byte order and are accessed from their beginning, regardless of
+	 * their position. The output frames are packed without gaps.
+	 *
+	 * @param src    The input audio samples to process.
+	 * @param dest   The target buffer for processed audio samples.
+	 * @param frames The number of 10 ms frames to process.
+	 *
+	 * @return The success/error code. 0 if processed successfully.
+	 */
+	public int processStream(ByteBuffer src, ByteBuffer dest, int frames) {
+		return processDirect(src, dest, inputConfig, outputConfig, frames, false);
+	}
+
+	/**
+	 * Processes a number of consecutive 10 ms frames of interleaved 16-bit PCM
+	 * audio for the reverse direction audio stream in one call. The audio
+	 * formats must be set with {@link #setReverseStreamConfig} beforehand.
+	 * Both buffers must be direct buffers in native byte order and are accessed
+	 * from their beginning, regardless of their position. The output frames
+	 * are packed without gaps.
+	 *
+	 * @param src    The input audio samples to process.
+	 * @param dest   The target buffer for processed audio samples.
+	 * @param frames The number of 10 ms frames to process.
+	 *
+	 * @return The success/error code. 0 if processed successfully.
+	 */
+	public int processReverseStream(ByteBuffer src, ByteBuffer dest, int frames) {
+		return processDirect(src, dest, reverseInputConfig, reverseOutputConfig,
+				frames, true);
+	}
+
 	@Override
 	public native void dispose();
 
+	private int processDirect(ByteBuffer src, ByteBuffer dest,
+			AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig, int frames,
+			boolean reverse) {
+		if (isNull(inputConfig) || isNull(outputConfig)) {
+			throw new IllegalStateException("Stream config is not set");
+		}
+		if (!src.isDirect() || !dest.isDirect()) {
+			throw new IllegalArgumentException("Buffers must be direct buffers");
+		}
+
+		int srcSize = inputConfig.sampleRate / 100 * inputConfig.channels * 2;
+		int dstSize = outputConfig.sampleRate / 100 * outputConfig.channels * 2;
+
+		if (frames < 1 || src.capacity() < srcSize * frames
+				|| dest.capacity() < dstSize * frames) {
+			throw new IllegalArgumentException("Buffers too small for " + frames + " frames");
+		}
+
+		return processDirect(src, dest, inputConfig.sampleRate,
+				inputConfig.channels, outputConfig.sampleRate,
+				outputConfig.channels, frames, reverse);
+	}
+
 	private native void initialize();
 
 	private native void updateStats();
 
+	private native void updateFrameStats(ByteBuffer buffer);
+
+	private native int processDirect(ByteBuffer src, ByteBuffer dest,
+			int srcSampleRate, int srcChannels, int dstSampleRate,
+			int dstChannels, int frames, boolean reverse);
+
 }
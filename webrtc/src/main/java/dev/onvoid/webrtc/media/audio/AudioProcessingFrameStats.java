@@ -0,0 +1,81 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+/**
+ * Lightweight per-frame statistics of {@link AudioProcessing}, e.g. for voice
+ * activity gating. The values are backed by a direct buffer that is written by
+ * the native side in a single call, without setting Java fields one by one.
+ * For the complete set of statistics use {@link
+ * AudioProcessing#getStatistics()}.
+ *
+ * @author Alex Andres
+ */
+public class AudioProcessingFrameStats {
+
+	static final int FLAG_VOICE_DETECTED = 1;
+	static final int FLAG_VOICE_AVAILABLE = 1 << 1;
+	static final int FLAG_DELAY_AVAILABLE = 1 << 2;
+
+	/** Layout: int flags, int delay in milliseconds. */
+	static final int SIZE = 8;
+
+	final ByteBuffer buffer;
+
+
+	AudioProcessingFrameStats() {
+		buffer = ByteBuffer.allocateDirect(SIZE).order(ByteOrder.nativeOrder());
+	}
+
+	/**
+	 * True if voice is detected in the last capture frame, after processing.
+	 * Only reported if voice detection is enabled via {@code
+	 * AudioProcessingConfig}.
+	 *
+	 * @return True if voice is detected.
+	 */
+	public boolean isVoiceDetected() {
+		return (buffer.getInt(0) & FLAG_VOICE_DETECTED) != 0;
+	}
+
+	/**
+	 * @return True if voice detection is enabled and reported a result.
+	 */
+	public boolean hasVoiceDetection() {
+		return (buffer.getInt(0) & FLAG_VOICE_AVAILABLE) != 0;
+	}
+
+	/**
+	 * The instantaneous delay estimate produced in the AEC.
+	 *
+	 * @return The delay in milliseconds, 0 if not available.
+	 */
+	public int getDelayMs() {
+		return buffer.getInt(4);
+	}
+
+	/**
+	 * @return True if the echo canceller reported a delay estimate.
+	 */
+	public boolean hasDelay() {
+		return (buffer.getInt(0) & FLAG_DELAY_AVAILABLE) != 0;
+	}
+
+}
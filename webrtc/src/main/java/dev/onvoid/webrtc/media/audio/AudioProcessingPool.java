@@ -0,0 +1,196 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static java.util.Objects.requireNonNull;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+import dev.onvoid.webrtc.internal.NativeLoader;
+
+import java.nio.ByteBuffer;
+import java.util.ArrayDeque;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.Queue;
+
+/**
+ * Processes the audio of many {@link AudioProcessing} instances on a fixed
+ * number of native worker threads. Frames are submitted without blocking and
+ * processed asynchronously, the results are collected with {@link #poll}. All
+ * frames of a stream are processed in the order they were submitted.
+ * <p>
+ * The buffers passed to {@link #submit} are accessed by a worker thread and
+ * must not be modified until the corresponding result has been polled. The
+ * pool keeps the buffers reachable until then. If the results are not
+ * polled, the workers stop processing once the result queue is full.
+ *
+ * @author Alex Andres
+ */
+public class AudioProcessingPool extends DisposableNativeObject {
+
+	static {
+		try {
+			NativeLoader.loadLibrary("webrtc-java");
+		}
+		catch (Exception e) {
+			throw new RuntimeException("Load library 'webrtc-java' failed", e);
+		}
+	}
+
+
+	/** The buffers of submitted frames per stream, in submission order. */
+	private final Map<Integer, Queue<ByteBuffer[]>> pending = new HashMap<>();
+
+
+	/**
+	 * Creates a new pool with the given number of worker threads. Make sure to
+	 * call {@link #dispose()} to stop the worker threads when finished
+	 * processing.
+	 *
+	 * @param threads   The number of worker threads, 0 to use one thread per
+	 *                  available processor.
+	 * @param queueSize The maximum number of pending frames per worker thread.
+	 */
+	public AudioProcessingPool(int threads, int queueSize) {
+		if (threads < 0 || queueSize < 1) {
+			throw new IllegalArgumentException("Invalid pool size");
+		}
+
+		initialize(threads, queueSize);
+	}
+
+	/**
+	 * Adds an audio stream that is processed by the given {@code
+	 * AudioProcessing} instance. The instance must not be used concurrently
+	 * outside of this pool.
+	 *
+	 * @param audioProcessing The audio processing instance of the stream.
+	 * @param inputConfig     The config that describes the audio input format.
+	 * @param outputConfig    The config that describes the desired audio output
+	 *                        format.
+	 *
+	 * @return The id of the stream used to submit frames.
+	 */
+	public int addStream(AudioProcessing audioProcessing,
+			AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig) {
+		return addStreamInternal(requireNonNull(audioProcessing),
+				requireNonNull(inputConfig), requireNonNull(outputConfig));
+	}
+
+	/**
+	 * Removes a stream. Already submitted frames of the stream are still
+	 * processed.
+	 *
+	 * @param streamId The id of the stream to remove.
+	 */
+	public native void removeStream(int streamId);
+
+	/**
+	 * Submits a number of consecutive 10 ms frames of interleaved 16-bit PCM
+	 * audio for processing. Both buffers must be direct buffers in native byte
+	 * order and are accessed from their beginning, regardless of their
+	 * position. The output frames are packed without gaps.
+	 *
+	 * @param streamId The id of the stream the frames belong to.
+	 * @param src      The input audio samples to process.
+	 * @param dest     The target buffer for processed audio samples.
+	 * @param frames   The number of 10 ms frames to process.
+	 * @param tag      A user defined value to identify the result.
+	 *
+	 * @return {@code true} if the frames were queued, {@code false} if the
+	 * queue of the stream is full.
+	 */
+	public boolean submit(int streamId, ByteBuffer src, ByteBuffer dest,
+			int frames, long tag) {
+		if (!src.isDirect() || !dest.isDirect()) {
+			throw new IllegalArgumentException("Buffers must be direct buffers");
+		}
+		if (frames < 1) {
+			throw new IllegalArgumentException("Invalid number of frames");
+		}
+
+		// Frames of a stream complete in order, keep their buffers reachable until polled.
+		synchronized (pending) {
+			if (!submitInternal(streamId, src, dest, frames, tag)) {
+				return false;
+			}
+
+			pending.computeIfAbsent(streamId, id -> new ArrayDeque<>())
+					.add(new ByteBuffer[] { src, dest });
+
+			return true;
+		}
+	}
+
+	/**
+	 * Retrieves the results of processed frames without blocking. The arrays
+	 * are filled from index 0 up to the returned count, at most up to the
+	 * length of the shortest array.
+	 *
+	 * @param tags      Receives the tags of the processed submissions.
+	 * @param streamIds Receives the stream ids of the processed submissions.
+	 * @param results   Receives the success/error codes, 0 if processed
+	 *                  successfully.
+	 *
+	 * @return The number of results retrieved.
+	 */
+	public int poll(long[] tags, int[] streamIds, int[] results) {
+		synchronized (pending) {
+			int count = pollInternal(tags, streamIds, results);
+
+			for (int i = 0; i < count; i++) {
+				Queue<ByteBuffer[]> buffers = pending.get(streamIds[i]);
+
+				if (buffers != null) {
+					buffers.poll();
+
+					if (buffers.isEmpty()) {
+						pending.remove(streamIds[i]);
+					}
+				}
+			}
+
+			return count;
+		}
+	}
+
+	@Override
+	public void dispose() {
+		// Joins the worker threads, no buffer is accessed afterwards.
+		disposeInternal();
+
+		synchronized (pending) {
+			pending.clear();
+		}
+	}
+
+	private native int pollInternal(long[] tags, int[] streamIds,
+			int[] results);
+
+	private native void disposeInternal();
+
+	private native void initialize(int threads, int queueSize);
+
+	private native int addStreamInternal(AudioProcessing audioProcessing,
+			AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig);
+
+	private native boolean submitInternal(int streamId, ByteBuffer src,
+			ByteBuffer dest, int frames, long tag);
+
+}
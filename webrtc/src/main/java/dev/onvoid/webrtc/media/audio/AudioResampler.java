@@ -20,14 +20,23 @@ import static java.util.Objects.requireNonNull;
 
 import dev.onvoid.webrtc.internal.DisposableNativeObject;
 
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+
 /**
  * Audio sampling rate converter. This resampler operates on audio frames of 10
- * milliseconds. Each sample is assumed to be a 16-bit PCM sample.
+ * milliseconds. Samples are either 16-bit PCM samples or 32-bit float samples
+ * when using {@link FloatBuffer}s. Multiple consecutive frames can be
+ * converted in one call.
  *
  * @author Alex Andres
  */
 public class AudioResampler extends DisposableNativeObject {
 
+	private int sourceFrames;
+
 	private int targetFrames;
 
 	private boolean initialized;
@@ -68,7 +77,8 @@ public class AudioResampler extends DisposableNativeObject {
 
 		resetInternal(sourceSampleRate, targetSampleRate, channels);
 
-		targetFrames = targetSampleRate / 100 * channels; // 10 ms frame
+		sourceFrames = sourceSampleRate / 100 * channels; // 10 ms frame
+		targetFrames = targetSampleRate / 100 * channels;
 
 		initialized = true;
 	}
@@ -76,8 +86,8 @@ public class AudioResampler extends DisposableNativeObject {
 	/**
 	 * Converts the input samples into the output samples with the sampling
 	 * frequency specified in the constructor. The audio input must be of the
-	 * length of 10 milliseconds. Accordingly, the output has the length of 10
-	 * milliseconds.
+	 * length of 10 milliseconds, or a multiple of it. Accordingly, the output
+	 * has the same duration.
 	 *
 	 * @param samplesIn  The audio samples to convert.
 	 * @param nSamplesIn The number of audio samples to consider from {@code
@@ -106,9 +116,83 @@ public class AudioResampler extends DisposableNativeObject {
 		return resampleInternal(samplesIn, nSamplesIn, samplesOut, maxSamplesOut);
 	}
 
+	/**
+	 * Converts 16-bit PCM samples from a direct buffer into another direct
+	 * buffer. Both buffers must be in native byte order and are accessed from
+	 * their beginning, regardless of their position. The input may contain
+	 * several consecutive 10 ms frames, which are converted in one call.
+	 *
+	 * @param samplesIn  The audio samples to convert.
+	 * @param nSamplesIn The number of audio samples to consider from {@code
+	 *                   samplesIn}, a multiple of a 10 ms frame.
+	 * @param samplesOut The converted audio samples.
+	 *
+	 * @return The number of converted audio samples.
+	 */
+	public int resample(ByteBuffer samplesIn, int nSamplesIn, ByteBuffer samplesOut) {
+		requireNonNull(samplesIn);
+		requireNonNull(samplesOut);
+
+		if (samplesIn.order() != ByteOrder.nativeOrder()
+				|| samplesOut.order() != ByteOrder.nativeOrder()) {
+			throw new IllegalArgumentException("Buffers must be in native byte order");
+		}
+
+		return resampleDirect(samplesIn, samplesIn.capacity() / 2, nSamplesIn,
+				samplesOut, samplesOut.capacity() / 2, false);
+	}
+
+	/**
+	 * Converts 32-bit float samples from a direct buffer into another direct
+	 * buffer. The buffers are accessed from their beginning, regardless of
+	 * their position. The input may contain several consecutive 10 ms frames,
+	 * which are converted in one call.
+	 *
+	 * @param samplesIn  The audio samples to convert.
+	 * @param nSamplesIn The number of audio samples to consider from {@code
+	 *                   samplesIn}, a multiple of a 10 ms frame.
+	 * @param samplesOut The converted audio samples.
+	 *
+	 * @return The number of converted audio samples.
+	 */
+	public int resample(FloatBuffer samplesIn, int nSamplesIn, FloatBuffer samplesOut) {
+		requireNonNull(samplesIn);
+		requireNonNull(samplesOut);
+
+		if (samplesIn.order() != ByteOrder.nativeOrder()
+				|| samplesOut.order() != ByteOrder.nativeOrder()) {
+			throw new IllegalArgumentException("Buffers must be in native byte order");
+		}
+
+		return resampleDirect(samplesIn, samplesIn.capacity(), nSamplesIn,
+				samplesOut, samplesOut.capacity(), true);
+	}
+
 	@Override
 	public native void dispose();
 
+	private int resampleDirect(Buffer samplesIn, int bufferSamplesIn,
+			int nSamplesIn, Buffer samplesOut, int maxSamplesOut,
+			boolean isFloat) {
+		if (!initialized) {
+			throw new IllegalStateException("Not initialized: Use reset() to set parameters");
+		}
+		if (!samplesIn.isDirect() || !samplesOut.isDirect()) {
+			throw new IllegalArgumentException("Buffers must be direct buffers");
+		}
+
+		nSamplesIn = Math.min(bufferSamplesIn, Math.max(0, nSamplesIn));
+
+		int frames = sourceFrames > 0 ? nSamplesIn / sourceFrames : 0;
+
+		if (Math.max(frames, 1) * targetFrames > maxSamplesOut) {
+			throw new IllegalArgumentException("Insufficient samples output length");
+		}
+
+		return resampleDirect(samplesIn, nSamplesIn, samplesOut, maxSamplesOut,
+				isFloat);
+	}
+
 	private native void initialize();
 
 	private native void resetInternal(int sourceSampleRate, int targetSampleRate,
@@ -117,4 +201,7 @@ public class AudioResampler extends DisposableNativeObject {
 	private native int resampleInternal(byte[] samplesIn, int nSamplesIn,
 			byte[] samplesOut, int maxSamplesOut);
 
+	private native int resampleDirect(Buffer samplesIn, int nSamplesIn,
+			Buffer samplesOut, int maxSamplesOut, boolean isFloat);
+
 }
@@ -35,8 +35,8 @@ public class AudioTrack extends MediaStreamTrack {
 
 	@Override
 	public void dispose() {
-		for (long nativeSink : sinks.values()) {
-			removeSinkInternal(nativeSink);
+		for (Map.Entry<AudioTrackSink, Long> entry : sinks.entrySet()) {
+			detachSink(entry.getKey(), entry.getValue());
 		}
 
 		sinks.clear();
@@ -46,7 +46,8 @@ public class AudioTrack extends MediaStreamTrack {
 
 	/**
 	 * Adds an AudioSink to the track. A track can have any number of
-	 * AudioSinks.
+	 * AudioSinks. A {@link WavAudioFileSink} is attached natively and receives
+	 * the audio data without passing it through Java.
 	 *
 	 * @param sink The audio sink that will receive audio data from the track.
 	 */
@@ -58,7 +59,14 @@ public class AudioTrack extends MediaStreamTrack {
 			return;
 		}
 
-		final long nativeSink = addSinkInternal(sink);
+		final long nativeSink;
+
+		if (sink instanceof WavAudioFileSink) {
+			nativeSink = addFileSinkInternal((WavAudioFileSink) sink);
+		}
+		else {
+			nativeSink = addSinkInternal(sink);
+		}
 
 		sinks.put(sink, nativeSink);
 	}
@@ -75,7 +83,7 @@ public class AudioTrack extends MediaStreamTrack {
 		final Long nativeSink = sinks.remove(sink);
 
 		if (nonNull(nativeSink)) {
-			removeSinkInternal(nativeSink);
+			detachSink(sink, nativeSink);
 		}
 	}
 
@@ -86,8 +94,21 @@ public class AudioTrack extends MediaStreamTrack {
 	 */
 	public native int getSignalLevel();
 
+	private void detachSink(AudioTrackSink sink, long nativeSink) {
+		if (sink instanceof WavAudioFileSink) {
+			removeFileSinkInternal(nativeSink);
+		}
+		else {
+			removeSinkInternal(nativeSink);
+		}
+	}
+
 	private native long addSinkInternal(AudioTrackSink sink);
 
 	private native void removeSinkInternal(long sinkHandle);
 
+	private native long addFileSinkInternal(WavAudioFileSink sink);
+
+	private native void removeFileSinkInternal(long sinkHandle);
+
 }
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static java.util.Objects.requireNonNull;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+/**
+ * Plays raw 16-bit PCM audio from a file. The file must be in the format the
+ * {@link AudioDeviceModule} requests for playout. The file is memory mapped
+ * and the mapping is shared by all sources playing the same file, each source
+ * keeps its own playback position.
+ * <p>
+ * When set on an {@link AudioDeviceModule}, the audio is read entirely on the
+ * native side and does not pass through Java. Make sure to detach the source
+ * before calling {@link #dispose()}.
+ *
+ * @author Alex Andres
+ */
+public class RawAudioFileSource extends DisposableNativeObject implements AudioSource {
+
+	/**
+	 * Creates a new {@code RawAudioFileSource} which plays the specified file
+	 * once and then silence.
+	 *
+	 * @param fileName The path of the raw PCM file.
+	 */
+	public RawAudioFileSource(String fileName) {
+		this(fileName, false);
+	}
+
+	/**
+	 * Creates a new {@code RawAudioFileSource} which plays the specified file.
+	 *
+	 * @param fileName The path of the raw PCM file.
+	 * @param loop     True to restart from the beginning when the end of the
+	 *                 file is reached.
+	 */
+	public RawAudioFileSource(String fileName, boolean loop) {
+		requireNonNull(fileName);
+
+		initialize(fileName, loop);
+	}
+
+	@Override
+	public native int onPlaybackData(byte[] audioSamples, int nSamples,
+			int nBytesPerSample, int nChannels, int samplesPerSec);
+
+	@Override
+	public native void dispose();
+
+	private native void initialize(String fileName, boolean loop);
+
+}
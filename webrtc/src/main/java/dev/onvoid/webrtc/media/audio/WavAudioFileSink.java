@@ -0,0 +1,66 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static java.util.Objects.requireNonNull;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+/**
+ * Writes 16-bit PCM audio to a WAV file. The file is created with the format
+ * of the first received audio frame. If the format changes later on, the audio
+ * is converted to the initial format.
+ * <p>
+ * When attached to an {@link AudioTrack} or an {@link AudioDeviceModule}, the
+ * audio is written entirely on the native side and does not pass through Java.
+ * File writes are buffered and performed on a background thread. Make sure to
+ * detach the sink before calling {@link #dispose()}, which finalizes the file.
+ *
+ * @author Alex Andres
+ */
+public class WavAudioFileSink extends DisposableNativeObject implements AudioSink, AudioTrackSink {
+
+	/**
+	 * Creates a new {@code WavAudioFileSink} which writes to the specified
+	 * file. The file is created immediately, the audio format is taken from
+	 * the first received audio frame.
+	 *
+	 * @param fileName The path of the WAV file.
+	 *
+	 * @throws Error if the file cannot be created.
+	 */
+	public WavAudioFileSink(String fileName) {
+		requireNonNull(fileName);
+
+		initialize(fileName);
+	}
+
+	@Override
+	public native void onRecordedData(byte[] audioSamples, int nSamples,
+			int nBytesPerSample, int nChannels, int samplesPerSec,
+			int totalDelayMS, int clockDrift);
+
+	@Override
+	public native void onData(byte[] data, int bitsPerSample, int sampleRate,
+			int channels, int frames);
+
+	@Override
+	public native void dispose();
+
+	private native void initialize(String fileName);
+
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static java.util.Objects.requireNonNull;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+/**
+ * Plays a 16-bit PCM WAV file of any sample rate and channel count. The file
+ * is converted to the playout format of the {@link AudioDeviceModule} when the
+ * source is created. The converted audio is kept in memory and shared by all
+ * sources playing the same file in the same format.
+ * <p>
+ * When set on an {@link AudioDeviceModule}, the audio is read entirely on the
+ * native side and does not pass through Java. Make sure to detach the source
+ * before calling {@link #dispose()}.
+ *
+ * @author Alex Andres
+ */
+public class WavAudioFileSource extends DisposableNativeObject implements AudioSource {
+
+	/**
+	 * Creates a new {@code WavAudioFileSource} which plays the specified file
+	 * once in 48 kHz stereo.
+	 *
+	 * @param fileName The path of the WAV file.
+	 */
+	public WavAudioFileSource(String fileName) {
+		this(fileName, 48000, 2, false);
+	}
+
+	/**
+	 * Creates a new {@code WavAudioFileSource} which plays the specified file
+	 * in the given playout format.
+	 *
+	 * @param fileName   The path of the WAV file.
+	 * @param sampleRate The playout sample rate of the audio device module.
+	 * @param channels   The playout channel count of the audio device module.
+	 * @param loop       True to restart from the beginning when the end of the
+	 *                   file is reached.
+	 */
+	public WavAudioFileSource(String fileName, int sampleRate, int channels,
+			boolean loop) {
+		requireNonNull(fileName);
+
+		initialize(fileName, sampleRate, channels, loop);
+	}
+
+	@Override
+	public native int onPlaybackData(byte[] audioSamples, int nSamples,
+			int nBytesPerSample, int nChannels, int samplesPerSec);
+
+	@Override
+	public native void dispose();
+
+	private native void initialize(String fileName, int sampleRate,
+			int channels, boolean loop);
+
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.video;
+
+/**
+ * Controls the native pool of I420 buffers used by {@link
+ * NativeI420Buffer#allocate(int, int)} and the desktop video source. Buffers
+ * are kept per resolution and reused once all references to them have been
+ * released, so that steady-state capture and scaling does not allocate
+ * memory.
+ *
+ * @author Alex Andres
+ */
+public final class I420BufferPool {
+
+	private I420BufferPool() {
+
+	}
+
+	/**
+	 * Sets the maximum number of buffers kept per resolution. If all buffers
+	 * of a resolution are in use, new buffers are allocated outside of the
+	 * pool. When shrinking, only free buffers are dropped, buffers in use are
+	 * kept until they have been released.
+	 *
+	 * @param maxBuffers The maximum number of buffers per resolution.
+	 */
+	public static void setMaxBuffers(int maxBuffers) {
+		if (maxBuffers < 1) {
+			throw new IllegalArgumentException("Max buffers must be positive");
+		}
+
+		setMaxBuffersInternal(maxBuffers);
+	}
+
+	/**
+	 * Returns the maximum number of buffers kept per resolution.
+	 *
+	 * @return The maximum number of buffers per resolution.
+	 */
+	public static native int getMaxBuffers();
+
+	/**
+	 * Releases all pooled buffers that are not in use.
+	 */
+	public static native void release();
+
+	private static native void setMaxBuffersInternal(int maxBuffers);
+
+}
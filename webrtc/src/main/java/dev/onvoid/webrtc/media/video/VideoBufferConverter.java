@@ -85,6 +85,115 @@ public final class VideoBufferConverter {
 		i420.release();
 	}
 
+	/**
+	 * Crops, scales and converts an I420 frame into the given pixel format in
+	 * one pass. Only the scaled frame is buffered internally, the source frame
+	 * is not copied into an intermediate buffer.
+	 *
+	 * @param src        The source frame buffer.
+	 * @param cropX      The left edge of the crop rectangle, must be even.
+	 * @param cropY      The top edge of the crop rectangle, must be even.
+	 * @param cropWidth  The width of the crop rectangle.
+	 * @param cropHeight The height of the crop rectangle.
+	 * @param dstWidth   The width of the scaled output image.
+	 * @param dstHeight  The height of the scaled output image.
+	 * @param dst        The destination buffer for the converted image.
+	 * @param fourCC     The pixel format of the converted image.
+	 *
+	 * @throws Exception if the conversion failed.
+	 */
+	public static void convertScaled(VideoFrameBuffer src, int cropX, int cropY,
+			int cropWidth, int cropHeight, int dstWidth, int dstHeight,
+			byte[] dst, FourCC fourCC) throws Exception {
+		if (dst == null) {
+			throw new NullPointerException("Destination buffer must not be null");
+		}
+
+		I420Buffer i420 = toCroppableI420(src, cropX, cropY, cropWidth,
+				cropHeight, dstWidth, dstHeight);
+
+		try {
+			I420toByteArrayScaled(
+					i420.getDataY(), i420.getStrideY(),
+					i420.getDataU(), i420.getStrideU(),
+					i420.getDataV(), i420.getStrideV(),
+					cropX, cropY, cropWidth, cropHeight,
+					dst,
+					dstWidth, dstHeight,
+					fourCC.value());
+		}
+		finally {
+			i420.release();
+		}
+	}
+
+	/**
+	 * Crops, scales and converts an I420 frame into the given pixel format in
+	 * one pass. Only the scaled frame is buffered internally, the source frame
+	 * is not copied into an intermediate buffer.
+	 *
+	 * @param src        The source frame buffer.
+	 * @param cropX      The left edge of the crop rectangle, must be even.
+	 * @param cropY      The top edge of the crop rectangle, must be even.
+	 * @param cropWidth  The width of the crop rectangle.
+	 * @param cropHeight The height of the crop rectangle.
+	 * @param dstWidth   The width of the scaled output image.
+	 * @param dstHeight  The height of the scaled output image.
+	 * @param dst        The direct destination buffer for the converted image.
+	 * @param fourCC     The pixel format of the converted image.
+	 *
+	 * @throws Exception if the conversion failed.
+	 */
+	public static void convertScaled(VideoFrameBuffer src, int cropX, int cropY,
+			int cropWidth, int cropHeight, int dstWidth, int dstHeight,
+			ByteBuffer dst, FourCC fourCC) throws Exception {
+		if (dst == null) {
+			throw new NullPointerException("Destination buffer must not be null");
+		}
+		if (!dst.isDirect()) {
+			throw new IllegalArgumentException("Destination buffer must be a direct buffer");
+		}
+
+		I420Buffer i420 = toCroppableI420(src, cropX, cropY, cropWidth,
+				cropHeight, dstWidth, dstHeight);
+
+		try {
+			I420toDirectBufferScaled(
+					i420.getDataY(), i420.getStrideY(),
+					i420.getDataU(), i420.getStrideU(),
+					i420.getDataV(), i420.getStrideV(),
+					cropX, cropY, cropWidth, cropHeight,
+					dst,
+					dstWidth, dstHeight,
+					fourCC.value());
+		}
+		finally {
+			i420.release();
+		}
+	}
+
+	private static I420Buffer toCroppableI420(VideoFrameBuffer src, int cropX,
+			int cropY, int cropWidth, int cropHeight, int dstWidth,
+			int dstHeight) {
+		if (src == null) {
+			throw new NullPointerException("Source buffer must not be null");
+		}
+		if (cropX < 0 || cropY < 0 || cropWidth < 1 || cropHeight < 1
+				|| cropX + cropWidth > src.getWidth()
+				|| cropY + cropHeight > src.getHeight()) {
+			throw new IllegalArgumentException("Crop rectangle exceeds the frame bounds");
+		}
+		if ((cropX & 1) != 0 || (cropY & 1) != 0) {
+			// The chroma planes are subsampled, an odd origin would shift them.
+			throw new IllegalArgumentException("Crop origin must be even");
+		}
+		if (dstWidth < 1 || dstHeight < 1) {
+			throw new IllegalArgumentException("Invalid destination size");
+		}
+
+		return src.toI420();
+	}
+
 	private native static void I420toByteArray(
 			ByteBuffer srcY, int srcStrideY,
 			ByteBuffer srcU, int srcStrideU,
@@ -101,4 +210,22 @@ public final class VideoBufferConverter {
 			int width, int height,
 			int fourCC) throws Exception;
 
+	private native static void I420toByteArrayScaled(
+			ByteBuffer srcY, int srcStrideY,
+			ByteBuffer srcU, int srcStrideU,
+			ByteBuffer srcV, int srcStrideV,
+			int cropX, int cropY, int cropWidth, int cropHeight,
+			byte[] dst,
+			int dstWidth, int dstHeight,
+			int fourCC) throws Exception;
+
+	private native static void I420toDirectBufferScaled(
+			ByteBuffer srcY, int srcStrideY,
+			ByteBuffer srcU, int srcStrideU,
+			ByteBuffer srcV, int srcStrideV,
+			int cropX, int cropY, int cropWidth, int cropHeight,
+			ByteBuffer dst,
+			int dstWidth, int dstHeight,
+			int fourCC) throws Exception;
+
 }
@@ -30,6 +30,14 @@ public class VideoCapture extends NativeObject {
 
 	public native void setVideoSink(VideoTrackSink sink);
 
+	/**
+	 * Writes captured frames into the given ring instead of passing them to
+	 * a {@link VideoTrackSink}. Replaces a previously set sink.
+	 *
+	 * @param ring The ring to write the frames into.
+	 */
+	public native void setVideoFrameRing(VideoFrameRing ring);
+
 	public native void start();
 
 	public native void stop();
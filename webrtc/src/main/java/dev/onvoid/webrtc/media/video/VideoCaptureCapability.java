@@ -26,11 +26,23 @@ public class VideoCaptureCapability {
 
 	public final int frameRate;
 
+	/**
+	 * The pixel format in which the device delivers frames. With {@link
+	 * VideoType#UNKNOWN}, I420 is requested.
+	 */
+	public final VideoType videoType;
+
 
 	public VideoCaptureCapability(int width, int height, int frameRate) {
+		this(width, height, frameRate, VideoType.UNKNOWN);
+	}
+
+	public VideoCaptureCapability(int width, int height, int frameRate,
+			VideoType videoType) {
 		this.width = width;
 		this.height = height;
 		this.frameRate = frameRate;
+		this.videoType = videoType;
 	}
 
 	@Override
@@ -45,18 +57,18 @@ public class VideoCaptureCapability {
 		VideoCaptureCapability other = (VideoCaptureCapability) o;
 
 		return width == other.width && height == other.height &&
-				frameRate == other.frameRate;
+				frameRate == other.frameRate && videoType == other.videoType;
 	}
 
 	@Override
 	public int hashCode() {
-		return Objects.hash(width, height, frameRate);
+		return Objects.hash(width, height, frameRate, videoType);
 	}
 
 	@Override
 	public String toString() {
-		return String.format("%s [width=%s, height=%s, frameRate=%s]",
+		return String.format("%s [width=%s, height=%s, frameRate=%s, videoType=%s]",
 				VideoCaptureCapability.class.getSimpleName(),
-				width, height, frameRate);
+				width, height, frameRate, videoType);
 	}
 }
@@ -16,6 +16,8 @@
 
 package dev.onvoid.webrtc.media.video;
 
+import java.nio.ByteBuffer;
+
 public class VideoDesktopSource extends VideoTrackSource {
 
 	public VideoDesktopSource() {
@@ -30,12 +32,41 @@ public class VideoDesktopSource extends VideoTrackSource {
 
 	public native void setMaxFrameSize(int width, int height);
 
+	/**
+	 * Sets the number of horizontal stripes captured frames are split into
+	 * to be converted on multiple threads. With 0, the default, one stripe
+	 * per processor core is used.
+	 *
+	 * @param stripes The number of conversion stripes.
+	 */
+	public native void setConversionStripes(int stripes);
+
 	public native void start();
 
 	public native void stop();
 
+	public native VideoDesktopSourceStats getStats();
+
 	public native void dispose();
 
+	/**
+	 * Processes a BGRA frame as if it was captured, used for testing. Only
+	 * the given updated rectangles are treated as changed, packed as x, y,
+	 * width and height. With {@code drop} set the frame is handled like a
+	 * frame dropped to respect the frame rate constraint.
+	 *
+	 * @param frame        The BGRA frame pixels in a direct buffer.
+	 * @param width        The frame width.
+	 * @param height       The frame height.
+	 * @param updatedRects The changed areas of the frame.
+	 * @param drop         Whether to drop the frame.
+	 *
+	 * @throws RuntimeException if the buffer holds less than {@code width *
+	 *                          height * 4} bytes or the source is capturing.
+	 */
+	native void processFrame(ByteBuffer frame, int width, int height,
+			int[] updatedRects, boolean drop);
+
 	private native void initialize();
 
 }
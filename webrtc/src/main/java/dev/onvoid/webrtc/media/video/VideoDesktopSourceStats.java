@@ -0,0 +1,57 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.video;
+
+/**
+ * Capture statistics of a {@link VideoDesktopSource}. The rates are measured
+ * over the last second, the counters since the source has been started.
+ *
+ * @author Alex Andres
+ */
+public class VideoDesktopSourceStats {
+
+	/** The achieved capture frame rate. */
+	public final double frameRate;
+
+	/** The average time in milliseconds it took to capture a frame. */
+	public final double captureTimeMs;
+
+	/** The number of captured frames. */
+	public final long framesCaptured;
+
+	/**
+	 * The number of frames skipped because capturing fell behind the
+	 * configured frame rate.
+	 */
+	public final long framesSkipped;
+
+
+	public VideoDesktopSourceStats(double frameRate, double captureTimeMs,
+			long framesCaptured, long framesSkipped) {
+		this.frameRate = frameRate;
+		this.captureTimeMs = captureTimeMs;
+		this.framesCaptured = framesCaptured;
+		this.framesSkipped = framesSkipped;
+	}
+
+	@Override
+	public String toString() {
+		return String.format("%s [frameRate=%s, captureTimeMs=%s, framesCaptured=%s, framesSkipped=%s]",
+				VideoDesktopSourceStats.class.getSimpleName(),
+				frameRate, captureTimeMs, framesCaptured, framesSkipped);
+	}
+}
@@ -18,6 +18,16 @@ package dev.onvoid.webrtc.media.video;
 
 import dev.onvoid.webrtc.internal.RefCounted;
 
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * A video frame passed to {@link VideoTrackSink}s and desktop capture
+ * callbacks. The frame is owned by the caller of the callback and is only
+ * valid until the callback returns. To keep the frame longer, call {@link
+ * #retain()} and later {@link #release()}. Each call to {@code release()}
+ * gives back the reference of one {@code retain()} call, additional calls to
+ * {@code release()} have no effect.
+ */
 public class VideoFrame implements RefCounted {
 	
 	/**
@@ -35,8 +45,11 @@ public class VideoFrame implements RefCounted {
 	 */
 	public final long timestampNs;
 
+	/** The number of references taken with retain() and not yet released. */
+	private final AtomicInteger retainCount = new AtomicInteger();
+
 
-	private VideoFrame(VideoFrameBuffer buffer, int rotation, long timestampNs) {
+	VideoFrame(VideoFrameBuffer buffer, int rotation, long timestampNs) {
 		if (buffer == null) {
 			throw new IllegalArgumentException("VideoFrameBuffer must not be null");
 		}
@@ -51,12 +64,17 @@ public class VideoFrame implements RefCounted {
 
 	@Override
 	public void retain() {
+		retainCount.incrementAndGet();
+
 		buffer.retain();
 	}
 
 	@Override
 	public void release() {
-		buffer.release();
+		// The reference of the callback is released by the caller, never here.
+		if (retainCount.getAndUpdate(count -> count > 0 ? count - 1 : 0) > 0) {
+			buffer.release();
+		}
 	}
 
 	@Override
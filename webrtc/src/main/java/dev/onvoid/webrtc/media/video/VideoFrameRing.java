@@ -0,0 +1,176 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package dev.onvoid.webrtc.media.video;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+/**
+ * A fixed set of direct buffers into which a {@link VideoCapture} writes
+ * frames round-robin, without allocating Java objects per frame. Frame {@code
+ * n}, counted from zero, is stored in slot {@code n % getSlotCount()}. The
+ * slot of frame {@code n} is overwritten while frame {@code n +
+ * getSlotCount()} is written, so the frame is only valid as long as {@code
+ * getFrameCount() - n < getSlotCount()}. Check this with {@link
+ * #isValid(long)} after reading the frame to detect overwrites.
+ * <p>
+ * Frames of another size than the ring are scaled to the ring size.
+ *
+ * @author Alex Andres
+ */
+public class VideoFrameRing extends DisposableNativeObject {
+
+	/**
+	 * The layout of the frames in the slots.
+	 */
+	public enum Format {
+
+		/**
+		 * The Y plane followed by the U and V planes, without padding.
+		 */
+		I420,
+
+		/**
+		 * The Y plane followed by an interleaved UV plane, without padding.
+		 */
+		NV12;
+
+	}
+
+	private final ByteBuffer[] slots;
+
+	private final ByteBuffer timestamps;
+
+	private final int width;
+
+	private final int height;
+
+	private final Format format;
+
+
+	/**
+	 * Creates a new ring with the given number of frame slots.
+	 *
+	 * @param slotCount The number of frame slots.
+	 * @param width     The frame width.
+	 * @param height    The frame height.
+	 * @param format    The layout of the frames in the slots.
+	 */
+	public VideoFrameRing(int slotCount, int width, int height, Format format) {
+		if (slotCount < 1) {
+			throw new IllegalArgumentException("Slot count must be positive");
+		}
+		if (width < 1 || height < 1) {
+			throw new IllegalArgumentException("Frame size must be positive");
+		}
+		if (format == null) {
+			throw new NullPointerException("Format must not be null");
+		}
+
+		int chromaSize = ((width + 1) / 2) * ((height + 1) / 2);
+		int frameSize = width * height + 2 * chromaSize;
+
+		this.slots = new ByteBuffer[slotCount];
+		this.timestamps = ByteBuffer.allocateDirect(slotCount * Long.BYTES)
+				.order(ByteOrder.nativeOrder());
+		this.width = width;
+		this.height = height;
+		this.format = format;
+
+		for (int i = 0; i < slotCount; i++) {
+			slots[i] = ByteBuffer.allocateDirect(frameSize);
+		}
+
+		initialize(slots, timestamps, width, height, format);
+	}
+
+	public int getSlotCount() {
+		return slots.length;
+	}
+
+	public int getWidth() {
+		return width;
+	}
+
+	public int getHeight() {
+		return height;
+	}
+
+	public Format getFormat() {
+		return format;
+	}
+
+	/**
+	 * Returns the slot buffer holding the frame with the given number. The
+	 * buffer is shared with the native writer and must not be modified.
+	 *
+	 * @param frameNumber The frame number, counted from zero.
+	 *
+	 * @return The slot buffer of the frame.
+	 */
+	public ByteBuffer getFrame(long frameNumber) {
+		return slots[(int) (frameNumber % slots.length)];
+	}
+
+	/**
+	 * Returns the capture timestamp of the frame with the given number.
+	 *
+	 * @param frameNumber The frame number, counted from zero.
+	 *
+	 * @return The timestamp in nanoseconds.
+	 */
+	public long getTimestamp(long frameNumber) {
+		int slot = (int) (frameNumber % slots.length);
+
+		return timestamps.getLong(slot * Long.BYTES);
+	}
+
+	/**
+	 * Checks whether the frame with the given number is completely written
+	 * and its slot is not being overwritten by a newer frame. Call this after
+	 * reading a frame to make sure the read data was not overwritten.
+	 *
+	 * @param frameNumber The frame number, counted from zero.
+	 *
+	 * @return true if the frame is valid, false otherwise.
+	 */
+	public boolean isValid(long frameNumber) {
+		return isValid(frameNumber, getFrameCount(), slots.length);
+	}
+
+	/**
+	 * Returns the number of frames written so far. Frames with a lower
+	 * number are completely written.
+	 *
+	 * @return The number of written frames.
+	 */
+	public native long getFrameCount();
+
+	@Override
+	public native void dispose();
+
+	static boolean isValid(long frameNumber, long frameCount, int slotCount) {
+		// The writer fills the slot of frame n + slotCount while the frame count is n + slotCount.
+		return frameNumber >= 0 && frameNumber < frameCount
+				&& frameCount - frameNumber < slotCount;
+	}
+
+	private native void initialize(ByteBuffer[] slots, ByteBuffer timestamps,
+			int width, int height, Format format);
+
+}
@@ -18,6 +18,16 @@ package dev.onvoid.webrtc.media.video;
 
 public interface VideoTrackSink {
 
+	/**
+	 * Called for each video frame of the track. The frame is only valid until
+	 * this method returns. To process the frame asynchronously, e.g. on an
+	 * encoder thread, call {@link VideoFrame#retain()} before returning and
+	 * {@link VideoFrame#release()} when finished with it. No copy of the frame
+	 * data is required. Calling {@code release()} without {@code retain()} has
+	 * no effect.
+	 *
+	 * @param frame The video frame.
+	 */
 	void onVideoFrame(VideoFrame frame);
 
 }
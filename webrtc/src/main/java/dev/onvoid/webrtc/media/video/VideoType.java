@@ -0,0 +1,57 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package dev.onvoid.webrtc.media.video;
+
+/**
+ * Pixel formats in which video capture devices deliver frames. Captured
+ * frames are always converted to I420 before they are passed on.
+ *
+ * @author Alex Andres
+ */
+public enum VideoType {
+
+	/**
+	 * Any format, the capture device chooses.
+	 */
+	UNKNOWN,
+
+	I420,
+
+	IYUV,
+
+	RGB24,
+
+	ARGB,
+
+	RGB565,
+
+	YUY2,
+
+	YV12,
+
+	UYVY,
+
+	/**
+	 * Motion JPEG, which many USB cameras require for high resolutions and
+	 * frame rates.
+	 */
+	MJPEG,
+
+	NV21,
+
+	BGRA;
+
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import java.util.Arrays;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+class NetworkEmulationTests {
+
+	private NetworkEmulation emulation;
+
+	private EmulatedNetwork callerNetwork;
+
+	private EmulatedNetwork calleeNetwork;
+
+
+	@BeforeEach
+	void init() {
+		assumeTrue(NetworkEmulation.isSupported(), "Network emulation not supported");
+
+		NetworkEmulationConfig config = new NetworkEmulationConfig();
+		config.queueDelayMs = 50;
+		config.delayStandardDeviationMs = 5;
+		config.linkCapacityKbps = 2000;
+
+		emulation = new NetworkEmulation();
+		callerNetwork = emulation.createNetwork();
+		calleeNetwork = emulation.createNetwork();
+
+		emulation.createLink(callerNetwork, calleeNetwork, config);
+		emulation.createLink(calleeNetwork, callerNetwork, config);
+	}
+
+	@AfterEach
+	void dispose() {
+		if (emulation != null) {
+			emulation.dispose();
+		}
+	}
+
+	@Test
+	void duplicateLink() {
+		assertThrows(RuntimeException.class, () -> {
+			emulation.createLink(callerNetwork, calleeNetwork, new NetworkEmulationConfig());
+		});
+	}
+
+	@Test
+	void textMessage() throws Exception {
+		PeerConnectionFactory callerFactory = new PeerConnectionFactory(callerNetwork);
+		PeerConnectionFactory calleeFactory = new PeerConnectionFactory(calleeNetwork);
+
+		TestPeerConnection caller = new TestPeerConnection(callerFactory);
+		TestPeerConnection callee = new TestPeerConnection(calleeFactory);
+
+		caller.setRemotePeerConnection(callee);
+		callee.setRemotePeerConnection(caller);
+
+		callee.setRemoteDescription(caller.createOffer());
+		caller.setRemoteDescription(callee.createAnswer());
+
+		caller.waitUntilConnected();
+		callee.waitUntilConnected();
+
+		// Degrade the link, the reliable data channel must still deliver.
+		NetworkEmulationConfig lossyConfig = new NetworkEmulationConfig();
+		lossyConfig.queueDelayMs = 50;
+		lossyConfig.lossPercent = 10;
+
+		emulation.updateLink(callerNetwork, calleeNetwork, lossyConfig);
+
+		caller.sendTextMessage("Hello world");
+		callee.sendTextMessage("Hi :)");
+
+		Thread.sleep(2000);
+
+		assertEquals(Arrays.asList("Hello world"), callee.getReceivedTexts());
+		assertEquals(Arrays.asList("Hi :)"), caller.getReceivedTexts());
+
+		caller.close();
+		callee.close();
+
+		callerFactory.dispose();
+		calleeFactory.dispose();
+	}
+
+}
@@ -27,6 +27,8 @@ import dev.onvoid.webrtc.media.video.VideoTrack;
 import java.util.ArrayList;
 import java.util.List;
 import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicLong;
 import java.util.concurrent.atomic.AtomicReference;
 
 import org.junit.jupiter.api.AfterEach;
@@ -375,6 +377,70 @@ class RTCPeerConnectionTests extends TestBase {
 		assertFalse(statsReport.getStats().isEmpty());
 	}
 
+	@Test
+	void setBitrate() {
+		peerConnection.setBitrate(30000, 300000, 2000000);
+		peerConnection.setBitrate(null, null, 1000000);
+
+		assertThrows(RuntimeException.class, () -> {
+			peerConnection.setBitrate(2000000, null, 30000);
+		});
+	}
+
+	@Test
+	void bandwidthEstimationObserver() {
+		peerConnection.setBandwidthEstimationObserver(bitrate -> { }, 500);
+		peerConnection.setBandwidthEstimationObserver(bitrate -> { }, 1000);
+		peerConnection.setBandwidthEstimationObserver(null, 0);
+
+		assertThrows(RuntimeException.class, () -> {
+			peerConnection.setBandwidthEstimationObserver(bitrate -> { }, 0);
+		});
+	}
+
+	@Test
+	void bandwidthEstimationCallback() throws Exception {
+		TestPeerConnection caller = new TestPeerConnection(factory);
+		TestPeerConnection callee = new TestPeerConnection(factory);
+
+		try {
+			AudioTrackSource audioSource = factory.createAudioSource(new AudioOptions());
+			AudioTrack audioTrack = factory.createAudioTrack("audioTrack", audioSource);
+
+			List<String> streamIds = new ArrayList<>();
+			streamIds.add("stream-0");
+
+			RTCPeerConnection callerConnection = caller.getPeerConnection();
+			callerConnection.addTrack(audioTrack, streamIds);
+
+			caller.setRemotePeerConnection(callee);
+			callee.setRemotePeerConnection(caller);
+
+			callee.setRemoteDescription(caller.createOffer());
+			caller.setRemoteDescription(callee.createAnswer());
+
+			caller.waitUntilConnected();
+			callee.waitUntilConnected();
+
+			CountDownLatch latch = new CountDownLatch(1);
+			AtomicLong estimate = new AtomicLong();
+
+			callerConnection.setBandwidthEstimationObserver(bitrate -> {
+				estimate.set(bitrate);
+				latch.countDown();
+			}, 200);
+
+			assertTrue(latch.await(10, TimeUnit.SECONDS));
+			assertTrue(estimate.get() > 0);
+
+			callerConnection.setBandwidthEstimationObserver(null, 0);
+		}
+		finally {
+			caller.close();
+			callee.close();
+		}
+	}
+
 	@Test
 	void statesWhenClosed() {
 		RTCConfiguration config = new RTCConfiguration();
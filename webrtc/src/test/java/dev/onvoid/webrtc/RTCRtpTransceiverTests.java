@@ -4,11 +4,21 @@ import dev.onvoid.webrtc.media.MediaType;
 import dev.onvoid.webrtc.media.audio.AudioOptions;
 import dev.onvoid.webrtc.media.audio.AudioTrackSource;
 import dev.onvoid.webrtc.media.audio.AudioTrack;
+import dev.onvoid.webrtc.media.video.TestDesktopFrames;
 import dev.onvoid.webrtc.media.video.VideoDesktopSource;
 import dev.onvoid.webrtc.media.video.VideoTrack;
 
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+import java.nio.ByteBuffer;
 import java.util.ArrayList;
+import java.util.Collections;
+import java.util.HashMap;
 import java.util.List;
+import java.util.Map;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.TimeUnit;
 
 import org.junit.jupiter.api.AfterEach;
 import org.junit.jupiter.api.BeforeEach;
@@ -16,6 +26,9 @@ import org.junit.jupiter.api.Test;
 
 class RTCRtpTransceiverTests extends TestBase {
 
+	private static final int FRAME_WIDTH = 1280;
+	private static final int FRAME_HEIGHT = 720;
+
 	private TestPeerConnection connection;
 
 
@@ -58,4 +71,137 @@ class RTCRtpTransceiverTests extends TestBase {
 //		videoTransceiver.setCodecPreferences(videoPreferences);
 	}
 
+	@Test
+	void simulcastEncodings() throws Exception {
+		String[] rids = { "q", "h", "f" };
+		double[] scales = { 4.0, 2.0, 1.0 };
+
+		RTCRtpTransceiverInit init = new RTCRtpTransceiverInit();
+		init.direction = RTCRtpTransceiverDirection.SEND_ONLY;
+
+		for (int i = 0; i < rids.length; i++) {
+			RTCRtpEncodingParameters encoding = new RTCRtpEncodingParameters();
+			encoding.rid = rids[i];
+			encoding.scaleResolutionDownBy = scales[i];
+			encoding.maxFramerate = 30.0;
+			encoding.scalabilityMode = "L1T3";
+
+			init.sendEncodings.add(encoding);
+		}
+
+		VideoDesktopSource desktopSource = new VideoDesktopSource();
+		VideoTrack videoTrack = factory.createVideoTrack("videoTrack", desktopSource);
+
+		RTCPeerConnection peerConnection = connection.getPeerConnection();
+		RTCRtpTransceiver transceiver = peerConnection.addTransceiver(videoTrack, init);
+
+		TestPeerConnection remote = new TestPeerConnection(factory);
+
+		try {
+			connection.setRemotePeerConnection(remote);
+			remote.setRemotePeerConnection(connection);
+
+			RTCSessionDescription offer = connection.createOffer();
+
+			assertTrue(offer.sdp.contains("a=simulcast:send q;h;f"));
+
+			remote.setRemoteDescription(offer);
+			connection.setRemoteDescription(remote.createAnswer());
+
+			connection.waitUntilConnected();
+			remote.waitUntilConnected();
+
+			List<RTCRtpEncodingParameters> encodings = transceiver.getSender()
+					.getParameters().encodings;
+
+			assertEquals(rids.length, encodings.size());
+
+			for (int i = 0; i < rids.length; i++) {
+				RTCRtpEncodingParameters encoding = encodings.get(i);
+
+				assertEquals(rids[i], encoding.rid);
+				assertEquals(scales[i], encoding.scaleResolutionDownBy);
+				assertEquals("L1T3", encoding.scalabilityMode);
+			}
+
+			// Start high enough to enable all layers without waiting for the ramp-up.
+			peerConnection.setBitrate(null, 2500000, null);
+
+			Map<String, Long> framesEncoded = Collections.emptyMap();
+			ByteBuffer frame = ByteBuffer.allocateDirect(FRAME_WIDTH * FRAME_HEIGHT * 4);
+
+			// Each layer needs enough resolution to be created, feed frames until
+			// all layers have been encoded.
+			for (int i = 0; i < 300 && !allEncoded(framesEncoded, rids); i++) {
+				fillFrame(frame, i);
+
+				TestDesktopFrames.deliver(desktopSource, frame, FRAME_WIDTH, FRAME_HEIGHT);
+
+				Thread.sleep(33);
+
+				if (i % 15 == 14) {
+					framesEncoded = getFramesEncoded(peerConnection);
+				}
+			}
+
+			for (String rid : rids) {
+				assertTrue(framesEncoded.getOrDefault(rid, 0L) > 0,
+						"No frames encoded for rid " + rid + ": " + framesEncoded);
+			}
+		}
+		finally {
+			remote.close();
+			desktopSource.dispose();
+		}
+	}
+
+	private static boolean allEncoded(Map<String, Long> framesEncoded, String[] rids) {
+		for (String rid : rids) {
+			if (framesEncoded.getOrDefault(rid, 0L) == 0) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	private static Map<String, Long> getFramesEncoded(RTCPeerConnection peerConnection)
+			throws Exception {
+		CompletableFuture<RTCStatsReport> future = new CompletableFuture<>();
+
+		peerConnection.getStats(future::complete);
+
+		Map<String, Long> framesEncoded = new HashMap<>();
+
+		for (RTCStats stats : future.get(5, TimeUnit.SECONDS).getStats().values()) {
+			if (stats.getType() != RTCStatsType.OUTBOUND_RTP) {
+				continue;
+			}
+
+			Map<String, Object> members = stats.getMembers();
+			Object rid = members.get("rid");
+			Object frames = members.get("framesEncoded");
+
+			if (rid != null && frames != null) {
+				framesEncoded.put(rid.toString(), ((Number) frames).longValue());
+			}
+		}
+
+		return framesEncoded;
+	}
+
+	private static void fillFrame(ByteBuffer frame, int index) {
+		// Moving gradient, so that the encoder has content to encode in each frame.
+		for (int y = 0; y < FRAME_HEIGHT; y++) {
+			for (int x = 0; x < FRAME_WIDTH; x++) {
+				int offset = (y * FRAME_WIDTH + x) * 4;
+				byte value = (byte) (x + y + index * 4);
+
+				frame.put(offset, value);
+				frame.put(offset + 1, (byte) (value + 85));
+				frame.put(offset + 2, (byte) (value + 170));
+				frame.put(offset + 3, (byte) 255);
+			}
+		}
+	}
+
 }
@@ -33,7 +33,7 @@ import org.junit.jupiter.api.Assertions;
  *
  * @author Alex Andres
  */
-class TestPeerConnection implements PeerConnectionObserver {
+public class TestPeerConnection implements PeerConnectionObserver {
 
 	private final List<String> receivedTexts;
 
@@ -48,7 +48,7 @@ class TestPeerConnection implements PeerConnectionObserver {
 	private RTCDataChannel remoteDataChannel;
 
 
-	TestPeerConnection(PeerConnectionFactory factory) {
+	public TestPeerConnection(PeerConnectionFactory factory) {
 		RTCConfiguration config = new RTCConfiguration();
 
 		localPeerConnection = factory.createPeerConnection(config, this);
@@ -92,11 +92,11 @@ class TestPeerConnection implements PeerConnectionObserver {
 		}
 	}
 
-	void waitUntilConnected() throws InterruptedException {
+	public void waitUntilConnected() throws InterruptedException {
 		connectedLatch.await();
 	}
 
-	RTCSessionDescription createOffer() throws Exception {
+	public RTCSessionDescription createOffer() throws Exception {
 		TestCreateDescObserver createObserver = new TestCreateDescObserver();
 		TestSetDescObserver setObserver = new TestSetDescObserver();
 
@@ -110,7 +110,7 @@ class TestPeerConnection implements PeerConnectionObserver {
 		return offerDesc;
 	}
 
-	RTCSessionDescription createAnswer() throws Exception {
+	public RTCSessionDescription createAnswer() throws Exception {
 		TestCreateDescObserver createObserver = new TestCreateDescObserver();
 		TestSetDescObserver setObserver = new TestSetDescObserver();
 
@@ -124,33 +124,33 @@ class TestPeerConnection implements PeerConnectionObserver {
 		return answerDesc;
 	}
 
-	void setRemotePeerConnection(TestPeerConnection connection) {
+	public void setRemotePeerConnection(TestPeerConnection connection) {
 		this.remotePeerConnection = connection.localPeerConnection;
 	}
 
-	void setRemoteDescription(RTCSessionDescription description) throws Exception {
+	public void setRemoteDescription(RTCSessionDescription description) throws Exception {
 		TestSetDescObserver setObserver = new TestSetDescObserver();
 
 		localPeerConnection.setRemoteDescription(description, setObserver);
 		setObserver.get();
 	}
 
-	void sendTextMessage(String message) throws Exception {
+	public void sendTextMessage(String message) throws Exception {
 		ByteBuffer data = ByteBuffer.wrap(message.getBytes(StandardCharsets.UTF_8));
 		RTCDataChannelBuffer buffer = new RTCDataChannelBuffer(data, false);
 
 		localDataChannel.send(buffer);
 	}
 
-	RTCPeerConnection getPeerConnection() {
+	public RTCPeerConnection getPeerConnection() {
 		return localPeerConnection;
 	}
 
-	List<String> getReceivedTexts() {
+	public List<String> getReceivedTexts() {
 		return receivedTexts;
 	}
 
-	void close() {
+	public void close() {
 		if (nonNull(localDataChannel)) {
 			localDataChannel.unregisterObserver();
 			localDataChannel.close();
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
+
+import org.junit.jupiter.api.Test;
+
+class WebRTCDiagnosticsTests extends TestBase {
+
+	@Test
+	void snapshot() {
+		WebRTCDiagnostics diagnostics = WebRTCDiagnostics.snapshot();
+
+		assertNotNull(diagnostics);
+	}
+
+	@Test
+	void peerConnectionCount() {
+		WebRTCDiagnostics before = WebRTCDiagnostics.snapshot();
+
+		RTCPeerConnection peerConnection = factory.createPeerConnection(
+				new RTCConfiguration(), candidate -> { });
+
+		WebRTCDiagnostics created = WebRTCDiagnostics.snapshot();
+
+		assertEquals(before.peerConnections + 1, created.peerConnections);
+		assertEquals(before.peerConnectionObservers + 1, created.peerConnectionObservers);
+
+		peerConnection.close();
+
+		WebRTCDiagnostics closed = WebRTCDiagnostics.snapshot();
+
+		assertEquals(before.peerConnections, closed.peerConnections);
+		assertEquals(before.peerConnectionObservers, closed.peerConnectionObservers);
+	}
+
+	@Test
+	void dataChannelObserverCount() {
+		RTCPeerConnection peerConnection = factory.createPeerConnection(
+				new RTCConfiguration(), candidate -> { });
+
+		RTCDataChannel dataChannel = peerConnection.createDataChannel("test",
+				new RTCDataChannelInit());
+
+		WebRTCDiagnostics before = WebRTCDiagnostics.snapshot();
+
+		dataChannel.registerObserver(new RTCDataChannelObserver() {
+
+			@Override
+			public void onBufferedAmountChange(long previousAmount) { }
+
+			@Override
+			public void onStateChange() { }
+
+			@Override
+			public void onMessage(RTCDataChannelBuffer buffer) { }
+		});
+
+		assertEquals(before.dataChannelObservers + 1,
+				WebRTCDiagnostics.snapshot().dataChannelObservers);
+
+		dataChannel.unregisterObserver();
+
+		assertEquals(before.dataChannelObservers,
+				WebRTCDiagnostics.snapshot().dataChannelObservers);
+
+		dataChannel.dispose();
+		peerConnection.close();
+	}
+
+}
@@ -23,6 +23,7 @@ import dev.onvoid.webrtc.media.video.VideoCaptureCapability;
 import dev.onvoid.webrtc.media.video.VideoDevice;
 
 import java.util.List;
+import java.util.concurrent.TimeUnit;
 
 import org.junit.jupiter.api.Test;
 
@@ -47,6 +48,26 @@ class MediaDevicesTests {
 			List<VideoCaptureCapability> capabilities = MediaDevices.getVideoCaptureCapabilities(device);
 
 			assertNotNull(capabilities);
+
+			for (VideoCaptureCapability capability : capabilities) {
+				assertNotNull(capability.videoType);
+			}
+		}
+	}
+
+	@Test
+	void getVideoCaptureCapabilitiesAsync() throws Exception {
+		List<VideoDevice> captureDevices = MediaDevices.getVideoCaptureDevices();
+
+		for (VideoDevice device : captureDevices) {
+			List<VideoCaptureCapability> capabilities = MediaDevices
+					.getVideoCaptureCapabilitiesAsync(device)
+					.get(10, TimeUnit.SECONDS);
+
+			assertNotNull(capabilities);
+
+			// A repeated query is answered from the cache.
+			assertEquals(capabilities.size(), MediaDevices.getVideoCaptureCapabilities(device).size());
 		}
 	}
 
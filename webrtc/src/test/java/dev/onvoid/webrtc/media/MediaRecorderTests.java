@@ -0,0 +1,292 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media;
+
+import static org.junit.jupiter.api.Assertions.*;
+import static org.junit.jupiter.api.Assumptions.assumeFalse;
+
+import dev.onvoid.webrtc.RTCRtpCodecParameters;
+import dev.onvoid.webrtc.RTCRtpReceiver;
+import dev.onvoid.webrtc.RTCRtpTransceiver;
+import dev.onvoid.webrtc.RTCRtpTransceiverDirection;
+import dev.onvoid.webrtc.RTCRtpTransceiverInit;
+import dev.onvoid.webrtc.TestBase;
+import dev.onvoid.webrtc.TestPeerConnection;
+import dev.onvoid.webrtc.media.audio.AudioDeviceModule;
+import dev.onvoid.webrtc.media.audio.AudioOptions;
+import dev.onvoid.webrtc.media.audio.AudioTrack;
+import dev.onvoid.webrtc.media.audio.AudioTrackSource;
+import dev.onvoid.webrtc.media.video.TestDesktopFrames;
+import dev.onvoid.webrtc.media.video.VideoDesktopSource;
+import dev.onvoid.webrtc.media.video.VideoTrack;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.List;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.io.TempDir;
+
+class MediaRecorderTests extends TestBase {
+
+	private static final int FRAME_WIDTH = 320;
+	private static final int FRAME_HEIGHT = 240;
+
+	private TestPeerConnection connection;
+
+	private MediaRecorder recorder;
+
+
+	@BeforeEach
+	void init() {
+		connection = new TestPeerConnection(factory);
+
+		AudioTrackSource audioSource = factory.createAudioSource(new AudioOptions());
+		AudioTrack audioTrack = factory.createAudioTrack("audioTrack", audioSource);
+
+		RTCRtpTransceiver transceiver = connection.getPeerConnection()
+				.addTransceiver(audioTrack, new RTCRtpTransceiverInit());
+
+		recorder = new MediaRecorder(transceiver.getReceiver());
+	}
+
+	@AfterEach
+	void dispose() {
+		recorder.dispose();
+		connection.close();
+	}
+
+	@Test
+	void nullReceiver() {
+		assertThrows(NullPointerException.class, () -> new MediaRecorder(null));
+	}
+
+	@Test
+	void codecOfPayloadType() {
+		List<RTCRtpCodecParameters> codecs = Arrays.asList(
+				codec(96, "VP8"), codec(97, "rtx"), codec(98, "VP9"),
+				codec(45, "AV1"));
+
+		assertEquals("VP9", MediaRecorder.findCodec(codecs, 98).codecName);
+		assertEquals("AV1", MediaRecorder.findCodec(codecs, 45).codecName);
+	}
+
+	@Test
+	void codecWithoutPayloadType() {
+		List<RTCRtpCodecParameters> codecs = Arrays.asList(
+				codec(63, "red"), codec(111, "opus"));
+
+		assertEquals("opus", MediaRecorder.findCodec(codecs, -1).codecName);
+	}
+
+	@Test
+	void startWithoutNegotiation() {
+		assertThrows(IllegalStateException.class, () -> recorder.start("test.ogg"));
+		assertFalse(recorder.isRecording());
+	}
+
+	@Test
+	void recordVideo(@TempDir Path tempDir) throws Exception {
+		VideoDesktopSource videoSource = new VideoDesktopSource();
+		VideoTrack videoTrack = factory.createVideoTrack("videoTrack", videoSource);
+
+		RTCRtpTransceiverInit init = new RTCRtpTransceiverInit();
+		init.direction = RTCRtpTransceiverDirection.SEND_ONLY;
+
+		connection.getPeerConnection().addTransceiver(videoTrack, init);
+
+		TestPeerConnection remote = new TestPeerConnection(factory);
+		MediaRecorder videoRecorder = null;
+
+		try {
+			connect(remote);
+
+			videoRecorder = new MediaRecorder(getReceiver(remote,
+					MediaStreamTrack.VIDEO_TRACK_KIND));
+
+			Path file = tempDir.resolve("video.ivf");
+
+			videoRecorder.start(file.toString());
+
+			ByteBuffer frame = ByteBuffer.allocateDirect(FRAME_WIDTH * FRAME_HEIGHT * 4);
+
+			for (int i = 0; i < 60; i++) {
+				// Change the whole frame, so that every frame is encoded.
+				for (int j = 0; j < frame.capacity(); j++) {
+					frame.put(j, (byte) (i * 4 + j));
+				}
+
+				TestDesktopFrames.deliver(videoSource, frame, FRAME_WIDTH, FRAME_HEIGHT);
+
+				Thread.sleep(33);
+			}
+
+			videoRecorder.stop();
+
+			ByteBuffer data = readFile(file);
+
+			assertEquals("DKIF", readString(data, 0, 4));
+			assertEquals(0, data.getShort(4));
+			assertEquals(32, data.getShort(6));
+			assertEquals(FRAME_WIDTH, data.getShort(12));
+			assertEquals(FRAME_HEIGHT, data.getShort(14));
+
+			int frameCount = data.getInt(24);
+			int frames = 0;
+			int offset = 32;
+
+			// Each frame has a 12 byte header with the frame size and timestamp.
+			while (offset < data.limit()) {
+				offset += 12 + data.getInt(offset);
+				frames++;
+			}
+
+			assertTrue(frameCount > 0);
+			assertEquals(frameCount, frames);
+			assertEquals(data.limit(), offset);
+		}
+		finally {
+			if (videoRecorder != null) {
+				videoRecorder.dispose();
+			}
+			remote.close();
+			videoSource.dispose();
+		}
+	}
+
+	@Test
+	void recordAudio(@TempDir Path tempDir) throws Exception {
+		AudioDeviceModule audioModule = new AudioDeviceModule();
+		boolean noRecordingDevices = audioModule.getRecordingDevices().isEmpty();
+		audioModule.dispose();
+
+		// Audio is only sent with a recording device.
+		assumeFalse(noRecordingDevices);
+
+		TestPeerConnection remote = new TestPeerConnection(factory);
+		MediaRecorder audioRecorder = null;
+
+		try {
+			connect(remote);
+
+			audioRecorder = new MediaRecorder(getReceiver(remote,
+					MediaStreamTrack.AUDIO_TRACK_KIND));
+
+			Path file = tempDir.resolve("audio.ogg");
+
+			audioRecorder.start(file.toString());
+
+			Thread.sleep(2000);
+
+			audioRecorder.stop();
+
+			ByteBuffer data = readFile(file);
+
+			int offset = 0;
+			int pages = 0;
+			int lastFlags = 0;
+
+			while (offset < data.limit()) {
+				assertEquals("OggS", readString(data, offset, 4));
+				assertEquals(0, data.get(offset + 4));
+				assertEquals(pages, data.getInt(offset + 18));
+
+				int flags = data.get(offset + 5);
+				int segments = data.get(offset + 26) & 0xFF;
+				int payloadOffset = offset + 27 + segments;
+				int payloadSize = 0;
+
+				for (int i = 0; i < segments; i++) {
+					payloadSize += data.get(offset + 27 + i) & 0xFF;
+				}
+
+				if (pages == 0) {
+					assertEquals(0x02, flags);
+					assertEquals("OpusHead", readString(data, payloadOffset, 8));
+					assertEquals(312, data.getShort(payloadOffset + 10));
+				}
+				else if (pages == 1) {
+					assertEquals("OpusTags", readString(data, payloadOffset, 8));
+				}
+
+				lastFlags = flags;
+				offset = payloadOffset + payloadSize;
+				pages++;
+			}
+
+			assertEquals(data.limit(), offset);
+			assertTrue(pages > 2);
+			assertEquals(0x04, lastFlags);
+		}
+		finally {
+			if (audioRecorder != null) {
+				audioRecorder.dispose();
+			}
+			remote.close();
+		}
+	}
+
+	private void connect(TestPeerConnection remote) throws Exception {
+		connection.setRemotePeerConnection(remote);
+		remote.setRemotePeerConnection(connection);
+
+		remote.setRemoteDescription(connection.createOffer());
+		connection.setRemoteDescription(remote.createAnswer());
+
+		connection.waitUntilConnected();
+		remote.waitUntilConnected();
+	}
+
+	private static RTCRtpReceiver getReceiver(TestPeerConnection connection,
+			String kind) {
+		for (RTCRtpReceiver receiver : connection.getPeerConnection().getReceivers()) {
+			if (kind.equals(receiver.getTrack().getKind())) {
+				return receiver;
+			}
+		}
+
+		throw new IllegalStateException("No " + kind + " receiver");
+	}
+
+	private static ByteBuffer readFile(Path file) throws Exception {
+		return ByteBuffer.wrap(Files.readAllBytes(file))
+				.order(ByteOrder.LITTLE_ENDIAN);
+	}
+
+	private static String readString(ByteBuffer data, int offset, int length) {
+		byte[] bytes = new byte[length];
+
+		for (int i = 0; i < length; i++) {
+			bytes[i] = data.get(offset + i);
+		}
+
+		return new String(bytes, StandardCharsets.US_ASCII);
+	}
+
+	private static RTCRtpCodecParameters codec(int payloadType, String name) {
+		return new RTCRtpCodecParameters(payloadType, MediaType.VIDEO, name,
+				90000, null, Collections.emptyMap());
+	}
+
+}
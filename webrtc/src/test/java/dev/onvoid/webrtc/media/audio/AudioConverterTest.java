@@ -16,7 +16,12 @@
 
 package dev.onvoid.webrtc.media.audio;
 
+import static org.junit.jupiter.api.Assertions.assertEquals;
 import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 
 import org.junit.jupiter.api.Test;
 
@@ -62,6 +67,125 @@ class AudioConverterTest {
 		convert(new ProcessBuffer(44100, 48000, 1, 2));
 	}
 
+	@Test
+	void upSampleUpMixWideband() {
+		convert(new ProcessBuffer(16000, 48000, 1, 2));
+	}
+
+	@Test
+	void downSampleDownMixWideband() {
+		convert(new ProcessBuffer(48000, 16000, 2, 1));
+	}
+
+	@Test
+	void upMixDuplicatesSamples() {
+		ProcessBuffer buffer = new ProcessBuffer(48000, 48000, 1, 2);
+		buffer.src[0] = 10;
+
+		convert(buffer);
+
+		assertEquals(10, buffer.dst[0]);
+		assertEquals(10, buffer.dst[2]);
+	}
+
+	@Test
+	void downMixAveragesSamples() {
+		ProcessBuffer buffer = new ProcessBuffer(48000, 48000, 2, 1);
+		buffer.src[0] = 10;
+		buffer.src[2] = 20;
+
+		convert(buffer);
+
+		assertEquals(15, buffer.dst[0]);
+	}
+
+	@Test
+	void upMixBatch() {
+		int frames = 3;
+		byte[] src = new byte[480 * 2 * frames];
+		byte[] dst = new byte[480 * 2 * 2 * frames];
+
+		// First sample of the last frame.
+		src[480 * 2 * (frames - 1)] = 10;
+
+		AudioConverter converter = new AudioConverter(48000, 1, 48000, 2);
+
+		assertEquals(480 * 2 * frames, converter.convert(src, dst, frames));
+
+		converter.dispose();
+
+		assertEquals(10, dst[480 * 2 * 2 * (frames - 1)]);
+		assertEquals(10, dst[480 * 2 * 2 * (frames - 1) + 2]);
+	}
+
+	@Test
+	void downSampleDirectBatch() {
+		int frames = 4;
+		ByteBuffer src = ByteBuffer.allocateDirect(480 * 2 * 2 * frames)
+				.order(ByteOrder.nativeOrder());
+		ByteBuffer dst = ByteBuffer.allocateDirect(160 * 2 * frames)
+				.order(ByteOrder.nativeOrder());
+
+		AudioConverter converter = new AudioConverter(48000, 2, 16000, 1);
+
+		assertEquals(160 * frames, converter.convert(src, dst, frames));
+
+		converter.dispose();
+	}
+
+	@Test
+	void downSampleDownMixRoundTripBatch() {
+		int frames = 10;
+		ByteBuffer src = ByteBuffer.allocateDirect(480 * 2 * 2 * frames)
+				.order(ByteOrder.nativeOrder());
+		ByteBuffer mono = ByteBuffer.allocateDirect(160 * 2 * frames)
+				.order(ByteOrder.nativeOrder());
+		ByteBuffer dst = ByteBuffer.allocateDirect(480 * 2 * 2 * frames)
+				.order(ByteOrder.nativeOrder());
+
+		// 1 kHz tone on both channels.
+		for (int i = 0; i < 480 * frames; i++) {
+			short sample = (short) (8000 * Math.sin(2 * Math.PI * 1000 * i / 48000.0));
+
+			src.putShort(i * 4, sample);
+			src.putShort(i * 4 + 2, sample);
+		}
+
+		AudioConverter down = new AudioConverter(48000, 2, 16000, 1);
+		AudioConverter up = new AudioConverter(16000, 1, 48000, 2);
+
+		assertEquals(160 * frames, down.convert(src, mono, frames));
+		assertEquals(480 * 2 * frames, up.convert(mono, dst, frames));
+
+		down.dispose();
+		up.dispose();
+
+		// Skip the first frames to account for the resampler delay.
+		long energy = 0;
+
+		for (int i = 480 * (frames - 2); i < 480 * frames; i++) {
+			short left = dst.getShort(i * 4);
+			short right = dst.getShort(i * 4 + 2);
+
+			assertEquals(left, right);
+
+			energy += Math.abs(left);
+		}
+
+		assertTrue(energy > 0);
+	}
+
+	@Test
+	void directHeapBuffer() {
+		AudioConverter converter = new AudioConverter(48000, 1, 48000, 2);
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			converter.convert(ByteBuffer.allocate(960), ByteBuffer.allocate(1920), 1);
+		});
+
+		converter.dispose();
+	}
+
 	@Test
 	void targetBufferUnderflow() {
 		ProcessBuffer buffer = new ProcessBuffer(48000, 24000, 2, 2);
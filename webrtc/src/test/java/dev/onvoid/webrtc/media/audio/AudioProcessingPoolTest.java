@@ -0,0 +1,122 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+class AudioProcessingPoolTest {
+
+	private final List<AudioProcessing> audioProcessings = new ArrayList<>();
+
+	private AudioProcessingPool pool;
+
+
+	@BeforeEach
+	void init() {
+		pool = new AudioProcessingPool(2, 16);
+	}
+
+	@AfterEach
+	void dispose() {
+		pool.dispose();
+
+		audioProcessings.forEach(AudioProcessing::dispose);
+	}
+
+	@Test
+	void processStreams() throws Exception {
+		AudioProcessingStreamConfig config = new AudioProcessingStreamConfig(48000, 1);
+		int streams = 4;
+		int frames = 2;
+		int frameSize = 480 * 2;
+
+		ByteBuffer[] src = new ByteBuffer[streams];
+		ByteBuffer[] dest = new ByteBuffer[streams];
+
+		for (int i = 0; i < streams; i++) {
+			AudioProcessing audioProcessing = new AudioProcessing();
+			audioProcessings.add(audioProcessing);
+
+			int streamId = pool.addStream(audioProcessing, config, config);
+
+			src[i] = allocate(frameSize * frames);
+			dest[i] = allocate(frameSize * frames);
+
+			assertTrue(pool.submit(streamId, src[i], dest[i], frames, i));
+		}
+
+		long[] tags = new long[streams];
+		int[] streamIds = new int[streams];
+		int[] results = new int[streams];
+		int completed = 0;
+		long timeout = System.currentTimeMillis() + 5000;
+
+		while (completed < streams && System.currentTimeMillis() < timeout) {
+			long[] t = new long[streams];
+			int[] s = new int[streams];
+			int[] r = new int[streams];
+			int count = pool.poll(t, s, r);
+
+			for (int i = 0; i < count; i++) {
+				tags[completed] = t[i];
+				streamIds[completed] = s[i];
+				results[completed] = r[i];
+				completed++;
+			}
+
+			Thread.sleep(1);
+		}
+
+		assertEquals(streams, completed);
+
+		Arrays.sort(tags);
+
+		for (int i = 0; i < streams; i++) {
+			assertEquals(i, tags[i]);
+			assertEquals(0, results[i]);
+		}
+	}
+
+	@Test
+	void submitHeapBuffer() {
+		AudioProcessing audioProcessing = new AudioProcessing();
+		audioProcessings.add(audioProcessing);
+
+		AudioProcessingStreamConfig config = new AudioProcessingStreamConfig(48000, 1);
+		int streamId = pool.addStream(audioProcessing, config, config);
+
+		assertThrows(IllegalArgumentException.class, () -> pool.submit(streamId,
+				ByteBuffer.allocate(960), allocate(960), 1, 0));
+	}
+
+	private static ByteBuffer allocate(int size) {
+		return ByteBuffer.allocateDirect(size).order(ByteOrder.nativeOrder());
+	}
+
+}
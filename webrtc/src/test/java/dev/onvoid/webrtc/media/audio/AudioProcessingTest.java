@@ -17,10 +17,16 @@
 package dev.onvoid.webrtc.media.audio;
 
 import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
 import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
 
 import dev.onvoid.webrtc.media.audio.AudioProcessingConfig.NoiseSuppression;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
 import org.junit.jupiter.api.AfterEach;
 import org.junit.jupiter.api.BeforeEach;
 import org.junit.jupiter.api.Test;
@@ -65,6 +71,24 @@ class AudioProcessingTest {
 		assertNotNull(audioProcessing.getStatistics());
 	}
 
+	@Test
+	void getFrameStats() {
+		AudioProcessingConfig config = new AudioProcessingConfig();
+		config.voiceDetection.enabled = true;
+
+		audioProcessing.applyConfig(config);
+
+		ProcessBuffer buffer = new ProcessBuffer(48000, 48000, 1, 1);
+
+		assertEquals(0, process(audioProcessing, buffer));
+
+		AudioProcessingFrameStats stats = audioProcessing.getFrameStatistics();
+
+		assertNotNull(stats);
+		assertTrue(stats.hasVoiceDetection());
+		assertFalse(stats.isVoiceDetected());
+	}
+
 	@Test
 	void processByteStream() {
 		ProcessBuffer buffer = new ProcessBuffer(48000, 48000, 1, 1);
@@ -72,6 +96,37 @@ class AudioProcessingTest {
 		assertEquals(0, process(audioProcessing, buffer));
 	}
 
+	@Test
+	void processDirectStream() {
+		int frames = 4;
+		ByteBuffer src = ByteBuffer.allocateDirect(frames * 480 * 2).order(ByteOrder.nativeOrder());
+		ByteBuffer dst = ByteBuffer.allocateDirect(frames * 320 * 2 * 2).order(ByteOrder.nativeOrder());
+
+		audioProcessing.setStreamConfig(new AudioProcessingStreamConfig(48000, 1),
+				new AudioProcessingStreamConfig(32000, 2));
+
+		assertEquals(0, audioProcessing.processStream(src, dst, frames));
+	}
+
+	@Test
+	void processDirectStreamWithoutConfig() {
+		ByteBuffer src = ByteBuffer.allocateDirect(960);
+		ByteBuffer dst = ByteBuffer.allocateDirect(960);
+
+		assertThrows(IllegalStateException.class, () -> audioProcessing.processStream(src, dst, 1));
+	}
+
+	@Test
+	void processDirectStreamUnderflow() {
+		ByteBuffer src = ByteBuffer.allocateDirect(960);
+		ByteBuffer dst = ByteBuffer.allocateDirect(960);
+
+		audioProcessing.setStreamConfig(new AudioProcessingStreamConfig(48000, 1),
+				new AudioProcessingStreamConfig(48000, 1));
+
+		assertThrows(IllegalArgumentException.class, () -> audioProcessing.processStream(src, dst, 2));
+	}
+
 	@Test
 	void processByteStreamDownMix() {
 		ProcessBuffer buffer = new ProcessBuffer(48000, 44100, 2, 1);
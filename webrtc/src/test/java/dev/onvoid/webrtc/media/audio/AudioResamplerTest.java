@@ -19,6 +19,10 @@ package dev.onvoid.webrtc.media.audio;
 import static org.junit.jupiter.api.Assertions.assertEquals;
 import static org.junit.jupiter.api.Assertions.assertThrows;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+
 import org.junit.jupiter.api.AfterEach;
 import org.junit.jupiter.api.BeforeEach;
 import org.junit.jupiter.api.Test;
@@ -94,6 +98,44 @@ class AudioResamplerTest {
 		assertEquals(buffer.nSamplesOut, result);
 	}
 
+	@Test
+	void resampleDirectBatch() {
+		int frames = 4;
+
+		ByteBuffer src = allocate(480 * frames * 2);
+		ByteBuffer dst = allocate(160 * frames * 2);
+
+		resampler.reset(48000, 16000, 1);
+
+		assertEquals(160 * frames, resampler.resample(src, 480 * frames, dst));
+	}
+
+	@Test
+	void resampleFloat() {
+		int frames = 2;
+
+		FloatBuffer src = allocate(480 * frames * 2 * 4).asFloatBuffer();
+		FloatBuffer dst = allocate(160 * frames * 2 * 4).asFloatBuffer();
+
+		resampler.reset(48000, 16000, 2);
+
+		assertEquals(160 * frames * 2, resampler.resample(src, 480 * frames * 2, dst));
+	}
+
+	@Test
+	void resampleHeapBuffer() {
+		resampler.reset(48000, 16000, 1);
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			resampler.resample(ByteBuffer.allocate(960).order(ByteOrder.nativeOrder()),
+					480, allocate(320));
+		});
+	}
+
+	private static ByteBuffer allocate(int size) {
+		return ByteBuffer.allocateDirect(size).order(ByteOrder.nativeOrder());
+	}
+
 	private static void reset(AudioResampler resampler, SampleBuffer buffer) {
 		resampler.reset(buffer.sampleRateIn, buffer.sampleRateOut, 1);
 	}
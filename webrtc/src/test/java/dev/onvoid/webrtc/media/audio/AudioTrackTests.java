@@ -20,9 +20,12 @@ import static org.junit.jupiter.api.Assertions.*;
 
 import dev.onvoid.webrtc.TestBase;
 
+import java.nio.file.Path;
+
 import org.junit.jupiter.api.AfterEach;
 import org.junit.jupiter.api.BeforeEach;
 import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.io.TempDir;
 
 class AudioTrackTests extends TestBase {
 
@@ -71,4 +74,21 @@ class AudioTrackTests extends TestBase {
 		audioTrack.removeSink(sink);
 	}
 
+	@Test
+	void addRemoveFileSink(@TempDir Path tempDir) {
+		WavAudioFileSink sink = new WavAudioFileSink(tempDir.resolve("audioTrack.wav").toString());
+
+		audioTrack.addSink(sink);
+		audioTrack.removeSink(sink);
+
+		sink.dispose();
+	}
+
+	@Test
+	void fileSinkInvalidPath(@TempDir Path tempDir) {
+		String fileName = tempDir.resolve("missing").resolve("audioTrack.wav").toString();
+
+		assertThrows(Error.class, () -> new WavAudioFileSink(fileName));
+	}
+
 }
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import dev.onvoid.webrtc.TestBase;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.io.TempDir;
+
+class RawAudioFileSourceTest extends TestBase {
+
+	@TempDir
+	Path tempDir;
+
+
+	@Test
+	void fileNotFound() {
+		assertThrows(Error.class, () -> new RawAudioFileSource(tempDir.resolve("none.raw").toString()));
+	}
+
+	@Test
+	void playOnce() throws Exception {
+		RawAudioFileSource source = new RawAudioFileSource(createFile(), false);
+
+		byte[] samples = new byte[8];
+
+		assertEquals(4, source.onPlaybackData(samples, 4, 2, 1, 48000));
+		assertArrayEquals(new byte[] { 1, 2, 3, 4, 5, 6, 0, 0 }, samples);
+
+		source.dispose();
+	}
+
+	@Test
+	void playLoop() throws Exception {
+		RawAudioFileSource source = new RawAudioFileSource(createFile(), true);
+
+		byte[] samples = new byte[8];
+
+		assertEquals(4, source.onPlaybackData(samples, 4, 2, 1, 48000));
+		assertArrayEquals(new byte[] { 1, 2, 3, 4, 5, 6, 1, 2 }, samples);
+
+		source.dispose();
+	}
+
+	private String createFile() throws Exception {
+		Path file = tempDir.resolve("audio.raw");
+
+		Files.write(file, new byte[] { 1, 2, 3, 4, 5, 6 });
+
+		return file.toString();
+	}
+
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import dev.onvoid.webrtc.TestBase;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.io.TempDir;
+
+class WavAudioFileSourceTest extends TestBase {
+
+	@TempDir
+	Path tempDir;
+
+
+	@Test
+	void fileNotFound() {
+		assertThrows(Error.class, () -> new WavAudioFileSource(tempDir.resolve("none.wav").toString()));
+	}
+
+	@Test
+	void playSameFormat() throws Exception {
+		String file = createFile(48000, 1, 480);
+		WavAudioFileSource source = new WavAudioFileSource(file, 48000, 1, false);
+
+		byte[] samples = new byte[960];
+
+		assertEquals(480, source.onPlaybackData(samples, 480, 2, 1, 48000));
+		assertEquals(1, samples[2]);
+		assertEquals(479 & 0xFF, samples[958] & 0xFF);
+
+		source.dispose();
+	}
+
+	@Test
+	void playConverted() throws Exception {
+		String file = createFile(16000, 1, 160);
+		WavAudioFileSource source = new WavAudioFileSource(file, 48000, 2, false);
+
+		byte[] samples = new byte[1920];
+
+		assertEquals(480, source.onPlaybackData(samples, 480, 4, 2, 48000));
+
+		source.dispose();
+	}
+
+	@Test
+	void loadConcurrently() throws Exception {
+		String file = createFile(16000, 1, 16000);
+		ExecutorService executor = Executors.newFixedThreadPool(4);
+		List<Future<WavAudioFileSource>> futures = new ArrayList<>();
+
+		try {
+			// Sources of the same file and format share one conversion.
+			for (int i = 0; i < 8; i++) {
+				futures.add(executor.submit(() -> new WavAudioFileSource(file, 48000, 2, false)));
+			}
+
+			for (Future<WavAudioFileSource> future : futures) {
+				WavAudioFileSource source = future.get();
+				byte[] samples = new byte[1920];
+
+				assertEquals(480, source.onPlaybackData(samples, 480, 4, 2, 48000));
+
+				source.dispose();
+			}
+		}
+		finally {
+			executor.shutdown();
+		}
+	}
+
+	private String createFile(int sampleRate, int channels, int frames) throws Exception {
+		Path file = tempDir.resolve("audio.wav");
+		int dataSize = frames * channels * 2;
+
+		ByteBuffer buffer = ByteBuffer.allocate(44 + dataSize);
+		buffer.order(ByteOrder.LITTLE_ENDIAN);
+		buffer.put("RIFF".getBytes()).putInt(36 + dataSize).put("WAVE".getBytes());
+		buffer.put("fmt ".getBytes()).putInt(16).putShort((short) 1);
+		buffer.putShort((short) channels).putInt(sampleRate);
+		buffer.putInt(sampleRate * channels * 2).putShort((short) (channels * 2));
+		buffer.putShort((short) 16);
+		buffer.put("data".getBytes()).putInt(dataSize);
+
+		for (int i = 0; i < frames * channels; i++) {
+			buffer.putShort((short) i);
+		}
+
+		Files.write(file, buffer.array());
+
+		return file.toString();
+	}
+
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.video;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+
+import dev.onvoid.webrtc.TestBase;
+import dev.onvoid.webrtc.WebRTCDiagnostics;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+class I420BufferPoolTest extends TestBase {
+
+	private int maxBuffers;
+
+
+	@BeforeEach
+	void init() {
+		maxBuffers = I420BufferPool.getMaxBuffers();
+
+		I420BufferPool.release();
+	}
+
+	@AfterEach
+	void dispose() {
+		I420BufferPool.setMaxBuffers(maxBuffers);
+		I420BufferPool.release();
+	}
+
+	@Test
+	void setMaxBuffers() {
+		I420BufferPool.setMaxBuffers(2);
+
+		assertEquals(2, I420BufferPool.getMaxBuffers());
+	}
+
+	@Test
+	void allocatePooled() {
+		NativeI420Buffer pooled = NativeI420Buffer.allocate(64, 48);
+
+		assertEquals(64, pooled.getWidth());
+		assertEquals(48, pooled.getHeight());
+		assertEquals(1, WebRTCDiagnostics.snapshot().i420Buffers);
+
+		pooled.release();
+	}
+
+	@Test
+	void reuseReleasedBuffer() {
+		NativeI420Buffer first = NativeI420Buffer.allocate(64, 48);
+		first.release();
+
+		NativeI420Buffer second = NativeI420Buffer.allocate(64, 48);
+
+		// The released buffer was handed out again, no new buffer was pooled.
+		WebRTCDiagnostics diagnostics = WebRTCDiagnostics.snapshot();
+
+		assertEquals(1, diagnostics.i420Buffers);
+		assertEquals(64 * 48 * 3 / 2, diagnostics.i420BufferBytes);
+
+		second.release();
+	}
+
+	@Test
+	void countUnpooledBuffer() {
+		I420BufferPool.setMaxBuffers(1);
+
+		NativeI420Buffer pooled = NativeI420Buffer.allocate(64, 48);
+		NativeI420Buffer unpooled = NativeI420Buffer.allocate(64, 48);
+
+		assertEquals(2, WebRTCDiagnostics.snapshot().i420Buffers);
+
+		unpooled.release();
+
+		assertEquals(1, WebRTCDiagnostics.snapshot().i420Buffers);
+
+		pooled.release();
+	}
+
+	@Test
+	void shrinkKeepsBuffersInUse() {
+		I420BufferPool.setMaxBuffers(3);
+
+		NativeI420Buffer first = NativeI420Buffer.allocate(64, 48);
+		NativeI420Buffer second = NativeI420Buffer.allocate(64, 48);
+		NativeI420Buffer third = NativeI420Buffer.allocate(64, 48);
+		third.release();
+
+		I420BufferPool.setMaxBuffers(1);
+
+		// Only the free buffer is dropped, the ones in use are still counted.
+		assertEquals(2, WebRTCDiagnostics.snapshot().i420Buffers);
+
+		second.release();
+
+		I420BufferPool.release();
+
+		assertEquals(1, WebRTCDiagnostics.snapshot().i420Buffers);
+
+		first.release();
+	}
+
+}
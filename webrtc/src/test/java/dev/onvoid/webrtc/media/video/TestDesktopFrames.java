@@ -0,0 +1,47 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.video;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Feeds synthetic BGRA frames into a {@link VideoDesktopSource} for tests
+ * outside of this package.
+ *
+ * @author Alex Andres
+ */
+public final class TestDesktopFrames {
+
+	private TestDesktopFrames() {
+
+	}
+
+	/**
+	 * Delivers a fully changed frame to the given source.
+	 *
+	 * @param source The source to deliver the frame to.
+	 * @param frame  The BGRA frame pixels in a direct buffer.
+	 * @param width  The frame width.
+	 * @param height The frame height.
+	 */
+	public static void deliver(VideoDesktopSource source, ByteBuffer frame,
+			int width, int height) {
+		source.processFrame(frame, width, height,
+				new int[] { 0, 0, width, height }, false);
+	}
+
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package dev.onvoid.webrtc.media.video;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+
+import dev.onvoid.webrtc.TestBase;
+import dev.onvoid.webrtc.media.FourCC;
+
+import java.nio.ByteBuffer;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+class VideoBufferConverterTest extends TestBase {
+
+	private NativeI420Buffer buffer;
+
+
+	@BeforeEach
+	void init() {
+		buffer = NativeI420Buffer.allocate(64, 48);
+	}
+
+	@AfterEach
+	void dispose() {
+		buffer.release();
+	}
+
+	@Test
+	void convertScaledToArray() throws Exception {
+		byte[] dst = new byte[16 * 12 * 4];
+
+		VideoBufferConverter.convertScaled(buffer, 8, 8, 32, 24, 16, 12, dst,
+				FourCC.ARGB);
+
+		// Opaque alpha of the last pixel, libyuv ARGB is stored as B, G, R, A.
+		assertEquals((byte) 0xFF, dst[dst.length - 1]);
+	}
+
+	@Test
+	void convertScaledToDirectBuffer() throws Exception {
+		ByteBuffer dst = ByteBuffer.allocateDirect(16 * 12 * 4);
+
+		VideoBufferConverter.convertScaled(buffer, 0, 0, 64, 48, 16, 12, dst,
+				FourCC.ARGB);
+
+		assertEquals((byte) 0xFF, dst.get(dst.capacity() - 1));
+	}
+
+	@Test
+	void convertLargeFrame() throws Exception {
+		// Large frames are converted in parallel row bands.
+		NativeI420Buffer frame = NativeI420Buffer.allocate(3840, 2160);
+		byte[] dst = new byte[3840 * 2160 * 4];
+
+		try {
+			VideoBufferConverter.convertFromI420(frame, dst, FourCC.ARGB);
+		}
+		finally {
+			frame.release();
+		}
+
+		assertEquals((byte) 0xFF, dst[3]);
+		assertEquals((byte) 0xFF, dst[dst.length - 1]);
+	}
+
+	@Test
+	void cropOutOfBounds() {
+		byte[] dst = new byte[16 * 12 * 4];
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			VideoBufferConverter.convertScaled(buffer, 40, 0, 32, 24, 16, 12,
+					dst, FourCC.ARGB);
+		});
+	}
+
+	@Test
+	void cropOddOrigin() {
+		byte[] dst = new byte[16 * 12 * 4];
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			VideoBufferConverter.convertScaled(buffer, 1, 0, 32, 24, 16, 12,
+					dst, FourCC.ARGB);
+		});
+		assertThrows(IllegalArgumentException.class, () -> {
+			VideoBufferConverter.convertScaled(buffer, 0, 3, 32, 24, 16, 12,
+					dst, FourCC.ARGB);
+		});
+	}
+
+}
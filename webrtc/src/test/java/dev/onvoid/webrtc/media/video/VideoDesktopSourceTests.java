@@ -0,0 +1,111 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.video;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+import dev.onvoid.webrtc.TestBase;
+
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.List;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+class VideoDesktopSourceTests extends TestBase {
+
+	private static final int WIDTH = 64;
+	private static final int HEIGHT = 64;
+
+	private VideoDesktopSource videoSource;
+
+	private VideoTrack videoTrack;
+
+	private List<Integer> lumaSamples;
+
+
+	@BeforeEach
+	void init() {
+		lumaSamples = new ArrayList<>();
+		videoSource = new VideoDesktopSource();
+		videoTrack = factory.createVideoTrack("desktopTrack", videoSource);
+
+		// Sample the luma of the top-left area.
+		videoTrack.addSink(frame -> {
+			I420Buffer buffer = frame.buffer.toI420();
+
+			lumaSamples.add(buffer.getDataY().get(8 * buffer.getStrideY() + 8) & 0xFF);
+
+			buffer.release();
+		});
+	}
+
+	@AfterEach
+	void dispose() {
+		videoTrack.dispose();
+		videoSource.dispose();
+	}
+
+	@Test
+	void partialUpdateAfterDroppedFrame() {
+		ByteBuffer frame = ByteBuffer.allocateDirect(WIDTH * HEIGHT * 4);
+
+		fill(frame, 0, 0, WIDTH, HEIGHT, (byte) 0);
+		videoSource.processFrame(frame, WIDTH, HEIGHT, new int[] { 0, 0, WIDTH, HEIGHT }, false);
+
+		// The top-left area changes in a dropped frame.
+		fill(frame, 0, 0, 16, 16, (byte) 255);
+		videoSource.processFrame(frame, WIDTH, HEIGHT, new int[] { 0, 0, 16, 16 }, true);
+
+		// The next frame only reports another changed area.
+		fill(frame, 32, 32, 16, 16, (byte) 255);
+		videoSource.processFrame(frame, WIDTH, HEIGHT, new int[] { 32, 32, 16, 16 }, false);
+
+		assertEquals(2, lumaSamples.size());
+		assertTrue(lumaSamples.get(0) < 32);
+		assertTrue(lumaSamples.get(1) > 200);
+	}
+
+	@Test
+	void insufficientBufferCapacity() {
+		ByteBuffer frame = ByteBuffer.allocateDirect(WIDTH * HEIGHT * 4 - 1);
+
+		assertThrows(RuntimeException.class, () -> {
+			videoSource.processFrame(frame, WIDTH, HEIGHT, new int[] { 0, 0, WIDTH, HEIGHT }, false);
+		});
+
+		assertTrue(lumaSamples.isEmpty());
+	}
+
+	private static void fill(ByteBuffer frame, int x, int y, int width, int height, byte value) {
+		for (int row = y; row < y + height; row++) {
+			for (int col = x; col < x + width; col++) {
+				int offset = (row * WIDTH + col) * 4;
+
+				frame.put(offset, value);
+				frame.put(offset + 1, value);
+				frame.put(offset + 2, value);
+				frame.put(offset + 3, (byte) 255);
+			}
+		}
+	}
+
+}
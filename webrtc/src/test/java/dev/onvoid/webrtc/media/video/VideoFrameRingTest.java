@@ -0,0 +1,66 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package dev.onvoid.webrtc.media.video;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertSame;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+import dev.onvoid.webrtc.TestBase;
+
+import org.junit.jupiter.api.Test;
+
+class VideoFrameRingTest extends TestBase {
+
+	@Test
+	void allocateSlots() {
+		VideoFrameRing ring = new VideoFrameRing(3, 64, 48,
+				VideoFrameRing.Format.NV12);
+
+		assertEquals(3, ring.getSlotCount());
+		assertEquals(64 * 48 * 3 / 2, ring.getFrame(0).capacity());
+		assertSame(ring.getFrame(1), ring.getFrame(4));
+		assertEquals(0, ring.getFrameCount());
+		assertFalse(ring.isValid(0));
+
+		ring.dispose();
+	}
+
+	@Test
+	void validityBoundary() {
+		int slots = 3;
+
+		// Not yet written.
+		assertFalse(VideoFrameRing.isValid(5, 5, slots));
+		// The newest frame and the oldest frame not being overwritten.
+		assertTrue(VideoFrameRing.isValid(4, 5, slots));
+		assertTrue(VideoFrameRing.isValid(3, 5, slots));
+		// Frame 2 shares its slot with frame 5, which is being written.
+		assertFalse(VideoFrameRing.isValid(2, 5, slots));
+	}
+
+	@Test
+	void invalidSize() {
+		assertThrows(IllegalArgumentException.class, () -> {
+			new VideoFrameRing(0, 64, 48, VideoFrameRing.Format.I420);
+		});
+		assertThrows(IllegalArgumentException.class, () -> {
+			new VideoFrameRing(2, 0, 48, VideoFrameRing.Format.I420);
+		});
+	}
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2023 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.video;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+
+import org.junit.jupiter.api.Test;
+
+class VideoFrameTest {
+
+	@Test
+	void retainThenRelease() {
+		CountingBuffer buffer = new CountingBuffer();
+		VideoFrame frame = new VideoFrame(buffer, 0, 0);
+
+		frame.retain();
+		frame.retain();
+		frame.release();
+		frame.release();
+
+		assertEquals(2, buffer.retained);
+		assertEquals(2, buffer.released);
+	}
+
+	@Test
+	void releaseWithoutRetain() {
+		CountingBuffer buffer = new CountingBuffer();
+		VideoFrame frame = new VideoFrame(buffer, 0, 0);
+
+		frame.release();
+
+		assertEquals(0, buffer.released);
+
+		// Surplus releases never give back more than was retained.
+		frame.retain();
+		frame.release();
+		frame.release();
+
+		assertEquals(1, buffer.retained);
+		assertEquals(1, buffer.released);
+	}
+
+	private static class CountingBuffer implements VideoFrameBuffer {
+
+		int retained;
+		int released;
+
+
+		@Override
+		public int getWidth() {
+			return 0;
+		}
+
+		@Override
+		public int getHeight() {
+			return 0;
+		}
+
+		@Override
+		public I420Buffer toI420() {
+			return null;
+		}
+
+		@Override
+		public VideoFrameBuffer cropAndScale(int cropX, int cropY,
+				int cropWidth, int cropHeight, int scaleWidth, int scaleHeight) {
+			return null;
+		}
+
+		@Override
+		public void retain() {
+			retained++;
+		}
+
+		@Override
+		public void release() {
+			released++;
+		}
+	}
+}